@@ -0,0 +1,79 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef INCLUDE_STURM_BENCHMARK_HH
+#define INCLUDE_STURM_BENCHMARK_HH
+
+// C++ standard libraries
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+// Sturm library
+#include "Sturm.hh"
+
+namespace Sturm::Benchmark {
+
+  /**
+   * \brief Time a callable.
+   *
+   * The callable is run repeatedly, doubling the number of repetitions until
+   * the whole run lasts at least \c min_time seconds.
+   * \param[in] function Callable to time.
+   * \param[in] min_time Minimum duration of the run in seconds.
+   * \return The average time of a single call in seconds.
+   * \tparam Function Callable with the signature `void()`.
+   */
+  template <typename Function>
+  double time(Function &&function, double min_time = 0.2) {
+    using Clock = std::chrono::steady_clock;
+    function();  // warm-up
+    for (long n{1};; n *= 2) {
+      Clock::time_point start{Clock::now()};
+      for (long i{0}; i < n; ++i) {
+        function();
+      }
+      double elapsed{
+          std::chrono::duration<double>(Clock::now() - start).count()};
+      if (elapsed >= min_time) {
+        return elapsed / static_cast<double>(n);
+      }
+    }
+  }
+
+  /**
+   * \brief Keep the optimizer from discarding a computed value.
+   * \param[in] value Value to keep.
+   * \tparam T Value type.
+   */
+  template <typename T>
+  inline void do_not_optimize(const T &value) {
+#if defined(_MSC_VER)
+    static const T *volatile sink;
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+  }
+
+  /**
+   * \brief Random number generator shared by the benchmarks.
+   * \return The generator, seeded with a fixed value for reproducibility.
+   */
+  inline std::mt19937 &generator() {
+    static std::mt19937 gen(42);
+    return gen;
+  }
+
+}  // namespace Sturm::Benchmark
+
+#endif  // INCLUDE_STURM_BENCHMARK_HH
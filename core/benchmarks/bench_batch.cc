@@ -0,0 +1,90 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/BatchSolver.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Bisection root solver, which keeps no state and can be called concurrently
+template <typename Real>
+bool bisection(Real a, Real b, std::function<Real(Real)> f, Real &x) {
+  Real fa{f(a)};
+  for (int i{0}; i < 200; ++i) {
+    x = (a + b) / 2;
+    if (x <= a || x >= b) {
+      return true;
+    }
+    Real fx{f(x)};
+    if (fx == 0) {
+      return true;
+    }
+    if ((fa < 0) == (fx < 0)) {
+      a  = x;
+      fa = fx;
+    } else {
+      b = x;
+    }
+  }
+  return false;
+}
+
+// Compare the throughput of a user loop building one Sturm sequence per
+// polynomial with the batch solver, for increasing degrees and numbers of
+// threads
+template <typename Real>
+void run(const char *name) {
+  constexpr Integer n_poly{10000};
+  std::uniform_real_distribution<Real> dist(-1.0, 1.0);
+  Integer n_max{std::max(
+      static_cast<Integer>(std::thread::hardware_concurrency()), Integer(4))};
+
+  std::printf("\n%s\n", name);
+  std::printf("%8s %14s %s\n", "degree", "loop [poly/s]", "batch [poly/s]");
+  for (Integer degree : {3, 5, 10, 20}) {
+    std::vector<Poly<Real>> polys(n_poly, Poly<Real>(degree + 1));
+    for (Poly<Real> &p : polys) {
+      for (Integer i{0}; i <= degree; ++i) {
+        p.coeffRef(i) = dist(Benchmark::generator());
+      }
+    }
+
+    double t_loop{Benchmark::time([&]() {
+      for (const Poly<Real> &p : polys) {
+        Sequence<Real> seq(p);
+        seq.separate_roots();
+        typename Sequence<Real>::Vector roots{
+            seq.refine_roots(bisection<Real>)};
+        Benchmark::do_not_optimize(roots.data());
+      }
+    })};
+    std::printf("%8d %14.4e", degree, n_poly / t_loop);
+
+    for (Integer n_threads{1}; n_threads <= n_max; n_threads *= 2) {
+      ThreadPool pool(n_threads);
+      BatchSolver<Real> solver(pool);
+      double t_batch{Benchmark::time([&]() {
+        Benchmark::do_not_optimize(solver.solve(polys, bisection<Real>));
+      })};
+      std::printf(" %4d:%10.4e", n_threads, n_poly / t_batch);
+    }
+    std::printf("\n");
+  }
+}
+
+int main() {
+  std::printf("threads: %u\n", std::thread::hardware_concurrency());
+  run<float>("float");
+  run<double>("double");
+  return 0;
+}
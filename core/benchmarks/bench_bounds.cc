@@ -0,0 +1,196 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Product of (x - r) over the given roots, times a leading coefficient
+Poly<double> from_roots(const std::vector<double> &roots, double leading) {
+  Poly<double> p(1), f(2);
+  p << leading;
+  for (double r : roots) {
+    f << -r, 1.0;
+    p = p * f;
+  }
+  return p;
+}
+
+// Chebyshev polynomial of the first kind T_n(x)
+Poly<double> chebyshev(Integer n) {
+  Poly<double> t_0(1), t_1(2), t_2, x(2);
+  t_0 << 1.0;
+  t_1 << 0.0, 1.0;
+  x << 0.0, 2.0;
+  for (Integer k{2}; k <= n; ++k) {
+    t_2 = x * t_1 - t_0;
+    t_0 = t_1;
+    t_1 = t_2;
+  }
+  return t_1;
+}
+
+// Sequence evaluations and time of the root separation on the Cauchy bound
+// and on the default bounds, averaged over a family
+void run(const char *name, const std::vector<Poly<double>> &polys) {
+  std::vector<Sequence<double>> seqs;
+  double width_cauchy{0.0}, width_tight{0.0};
+  long eval_cauchy{0}, eval_tight{0};
+  for (const Poly<double> &p : polys) {
+    seqs.emplace_back(p);
+    Sequence<double> &seq{seqs.back()};
+    double a, b, bound{seq.get(0).cauchy_bound()};
+    seq.get(0).root_bounds(a, b);
+    width_cauchy += 2 * bound;
+    width_tight += b - a;
+    Integer n_cauchy{seq.separate_roots(-bound, bound)};
+    eval_cauchy += seq.statistics().evaluations;
+    Integer n_tight{seq.separate_roots()};
+    eval_tight += seq.statistics().evaluations;
+    if (n_cauchy != n_tight) {
+      std::printf("%s: %d roots on the Cauchy bound, %d on the tight ones\n",
+                  name,
+                  n_cauchy,
+                  n_tight);
+    }
+  }
+  // Alternate the two timings, and which one runs first, and keep the
+  // fastest run of each, since the separations are short and the single
+  // runs are noisy
+  auto cauchy = [&seqs]() {
+    for (Sequence<double> &seq : seqs) {
+      double bound{seq.get(0).cauchy_bound()};
+      Benchmark::do_not_optimize(seq.separate_roots(-bound, bound));
+    }
+  };
+  auto tight = [&seqs]() {
+    for (Sequence<double> &seq : seqs) {
+      Benchmark::do_not_optimize(seq.separate_roots());
+    }
+  };
+  double t_cauchy{std::numeric_limits<double>::infinity()};
+  double t_tight{std::numeric_limits<double>::infinity()};
+  for (Integer round{0}; round < 10; ++round) {
+    if (round % 2 == 0) {
+      t_cauchy = std::min(t_cauchy, Benchmark::time(cauchy));
+      t_tight  = std::min(t_tight, Benchmark::time(tight));
+    } else {
+      t_tight  = std::min(t_tight, Benchmark::time(tight));
+      t_cauchy = std::min(t_cauchy, Benchmark::time(cauchy));
+    }
+  }
+  double n{static_cast<double>(polys.size())};
+  std::printf("%-16s %10.3e %10.3e %8.1f %8.1f %10.3e %10.3e %8.2f\n",
+              name,
+              width_cauchy / n,
+              width_tight / n,
+              eval_cauchy / n,
+              eval_tight / n,
+              t_cauchy / n,
+              t_tight / n,
+              t_cauchy / t_tight);
+}
+
+int main() {
+  constexpr Integer n_poly{100};
+  std::mt19937 &gen{Benchmark::generator()};
+  std::uniform_real_distribution<double> unit(0.0, 1.0), sym(-1.0, 1.0);
+  std::uniform_real_distribution<double> exponent(-4.0, 4.0);
+
+  std::printf("%-16s %10s %10s %8s %8s %10s %10s %8s\n",
+              "family",
+              "width",
+              "width",
+              "evals",
+              "evals",
+              "time [s]",
+              "time [s]",
+              "speedup");
+  std::printf("%-16s %10s %10s %8s %8s %10s %10s %8s\n",
+              "",
+              "cauchy",
+              "tight",
+              "cauchy",
+              "tight",
+              "cauchy",
+              "tight",
+              "");
+
+  // Random coefficients in [-1, 1]
+  for (Integer degree : {10, 20}) {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      Poly<double> p(degree + 1);
+      for (Integer i{0}; i <= degree; ++i) {
+        p.coeffRef(i) = sym(gen);
+      }
+      polys.push_back(p);
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "random %d", degree);
+    run(name, polys);
+  }
+
+  // Random coefficients with magnitudes in [1e-4, 1e4]
+  for (Integer degree : {10, 20}) {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      Poly<double> p(degree + 1);
+      for (Integer i{0}; i <= degree; ++i) {
+        p.coeffRef(i) = sym(gen) * std::pow(10.0, exponent(gen));
+      }
+      polys.push_back(p);
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "scaled %d", degree);
+    run(name, polys);
+  }
+
+  // Roots in [0, 1] and a small leading coefficient
+  {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      std::vector<double> roots(8);
+      for (double &r : roots) {
+        r = unit(gen);
+      }
+      polys.push_back(from_roots(roots, 1.0e-6));
+    }
+    run("small leading 8", polys);
+  }
+
+  // Roots in [1, 2] and [100, 101]
+  {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      std::vector<double> roots(6);
+      for (Integer i{0}; i < 6; ++i) {
+        roots[i] = (i < 3 ? 1.0 : 100.0) + unit(gen);
+      }
+      polys.push_back(from_roots(roots, 1.0));
+    }
+    run("positive 6", polys);
+  }
+
+  // Wilkinson and Chebyshev polynomials
+  {
+    std::vector<double> roots;
+    for (Integer k{1}; k <= 12; ++k) {
+      roots.push_back(k);
+    }
+    run("wilkinson 12", {from_roots(roots, 1.0)});
+    run("chebyshev 20", {chebyshev(20)});
+  }
+  return 0;
+}
@@ -0,0 +1,157 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Heap allocations, counted by the global allocation function
+static std::atomic<long> allocations{0};
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (void *ptr{std::malloc(size)}) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+// Product of (x - r) over the given roots
+Poly<double> from_roots(const std::vector<double> &roots) {
+  Poly<double> p(1), f(2);
+  p << 1.0;
+  for (double r : roots) {
+    f << -r, 1.0;
+    p = p * f;
+  }
+  return p;
+}
+
+// Heap allocations per call of a function, after a first call
+template <typename Function>
+double allocations_per_call(Function &&function) {
+  constexpr Integer n_calls{100};
+  function();
+  long start{allocations.load()};
+  for (Integer k{0}; k < n_calls; ++k) {
+    function();
+  }
+  return static_cast<double>(allocations.load() - start) / n_calls;
+}
+
+// Time and heap allocations of the root separation into the sequence, into
+// a result and into brackets, averaged over a family
+void run(const char *name,
+         const std::vector<Poly<double>> &polys,
+         double a,
+         double b) {
+  std::vector<Sequence<double>> seqs;
+  for (const Poly<double> &p : polys) {
+    seqs.emplace_back(p);
+  }
+  Sequence<double>::Result result;
+  Sequence<double>::Brackets brackets;
+  auto separate = [&]() {
+    for (Sequence<double> &seq : seqs) {
+      Benchmark::do_not_optimize(seq.separate_roots(a, b));
+    }
+  };
+  auto separate_result = [&]() {
+    for (const Sequence<double> &seq : seqs) {
+      Benchmark::do_not_optimize(seq.separate_roots(a, b, result));
+    }
+  };
+  auto separate_brackets = [&]() {
+    for (const Sequence<double> &seq : seqs) {
+      Benchmark::do_not_optimize(seq.separate_roots(a, b, brackets));
+    }
+  };
+  double n{static_cast<double>(polys.size())};
+  double t_sequence{Benchmark::time(separate) / n};
+  double t_result{Benchmark::time(separate_result) / n};
+  double t_brackets{Benchmark::time(separate_brackets) / n};
+  std::printf("%-16s %10.3e %10.3e %10.3e %6.1f %6.1f %6.1f %8.2f\n",
+              name,
+              t_sequence,
+              t_result,
+              t_brackets,
+              allocations_per_call(separate) / n,
+              allocations_per_call(separate_result) / n,
+              allocations_per_call(separate_brackets) / n,
+              t_sequence / t_brackets);
+}
+
+int main() {
+  constexpr Integer n_poly{100};
+  std::mt19937 &gen{Benchmark::generator()};
+  std::uniform_real_distribution<double> unit(0.0, 1.0), sym(-1.0, 1.0);
+
+  std::printf("%-16s %10s %10s %10s %6s %6s %6s %8s\n",
+              "family",
+              "time [s]",
+              "time [s]",
+              "time [s]",
+              "allocs",
+              "allocs",
+              "allocs",
+              "speedup");
+  std::printf("%-16s %10s %10s %10s %6s %6s %6s %8s\n",
+              "",
+              "sequence",
+              "result",
+              "brackets",
+              "seq",
+              "res",
+              "brk",
+              "");
+
+  // Random coefficients in [-1, 1]
+  for (Integer degree : {10, 20, 40}) {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      Poly<double> p(degree + 1);
+      for (Integer i{0}; i <= degree; ++i) {
+        p.coeffRef(i) = sym(gen);
+      }
+      polys.push_back(p);
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "random %d", degree);
+    run(name, polys, -2.0, 2.0);
+  }
+
+  // All the roots in [0, 1]
+  for (Integer degree : {6, 12}) {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      std::vector<double> roots(degree);
+      for (double &r : roots) {
+        r = unit(gen);
+      }
+      polys.push_back(from_roots(roots));
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "real %d", degree);
+    run(name, polys, 0.0, 1.0);
+  }
+  return 0;
+}
@@ -0,0 +1,66 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Compare the throughput of building a fresh Sturm sequence per polynomial
+// with rebuilding the same sequence object, for increasing degrees
+template <typename Real>
+void run(const char *name) {
+  constexpr Integer n_poly{64};
+  std::uniform_real_distribution<Real> dist(-1.0, 1.0);
+
+  std::printf("\n%s\n", name);
+  std::printf("%8s %16s %16s %8s\n",
+              "degree",
+              "fresh [build/s]",
+              "rebuild [build/s]",
+              "speedup");
+  for (Integer degree : {3, 4, 5, 6, 10, 20, 50}) {
+    std::vector<Poly<Real>> polys(n_poly, Poly<Real>(degree + 1));
+    for (Poly<Real> &p : polys) {
+      for (Integer i{0}; i <= degree; ++i) {
+        p.coeffRef(i) = dist(Benchmark::generator());
+      }
+    }
+
+    double t_fresh{Benchmark::time([&]() {
+      for (const Poly<Real> &p : polys) {
+        Sequence<Real> seq(p);
+        Benchmark::do_not_optimize(seq.length());
+      }
+    })};
+    Sequence<Real> seq;
+    double t_rebuild{Benchmark::time([&]() {
+      for (const Poly<Real> &p : polys) {
+        seq.build(p);
+        Benchmark::do_not_optimize(seq.length());
+      }
+    })};
+
+    std::printf("%8d %16.4e %16.4e %8.2f\n",
+                degree,
+                n_poly / t_fresh,
+                n_poly / t_rebuild,
+                t_fresh / t_rebuild);
+  }
+}
+
+int main() {
+  run<float>("float");
+  run<double>("double");
+  return 0;
+}
@@ -0,0 +1,131 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Product of (x - r) over the given roots
+Poly<double> from_roots(const std::vector<double> &roots) {
+  Poly<double> p(1), f(2);
+  p << 1.0;
+  for (double r : roots) {
+    f << -r, 1.0;
+    p = p * f;
+  }
+  return p;
+}
+
+// Polynomial with random coefficients in [-1, 1]
+Poly<double> random(Integer n) {
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  Poly<double> p(n + 1);
+  for (Integer i{0}; i <= n; ++i) {
+    p.coeffRef(i) = dist(Benchmark::generator());
+  }
+  return p;
+}
+
+// Sign variations on a grid that increase from left to right, i.e., that
+// are wrong
+Integer increases(const Sequence<double> &seq, double a, double b) {
+  constexpr Integer n_points{4000};
+  bool on_root;
+  Integer n_increases{0};
+  Integer v_prev{seq.sign_variations(a, on_root)};
+  for (Integer i{1}; i <= n_points; ++i) {
+    Integer v{seq.sign_variations(a + (b - a) * i / n_points, on_root)};
+    n_increases += v > v_prev;
+    v_prev = v;
+  }
+  return n_increases;
+}
+
+// Time of the root separation with the native and the certified signs, the
+// share of the signs escalated to the compensated scheme, and the wrong sign
+// variations on a grid of the interval
+void run(const char *name, const Poly<double> &p, double a, double b) {
+  Sequence<double> seq(p);
+  Integer n_native{seq.separate_roots(a, b)};
+  Integer inc_native{increases(seq, a, b)};
+  double t_native{Benchmark::time(
+      [&]() { Benchmark::do_not_optimize(seq.separate_roots(a, b)); })};
+  seq.set_certified(true);
+  Integer n_certified{seq.separate_roots(a, b)};
+  Integer inc_certified{increases(seq, a, b)};
+  double rate{static_cast<double>(seq.statistics().escalations) /
+              (seq.statistics().evaluations * seq.length())};
+  double t_certified{Benchmark::time(
+      [&]() { Benchmark::do_not_optimize(seq.separate_roots(a, b)); })};
+  std::printf("%-16s %6d %6d %6d %6d %8.2e %12.4e %12.4e %6.2f\n",
+              name,
+              n_native,
+              n_certified,
+              inc_native,
+              inc_certified,
+              rate,
+              t_native,
+              t_certified,
+              t_certified / t_native);
+}
+
+int main() {
+  std::printf("%-16s %6s %6s %6s %6s %8s %12s %12s %6s\n",
+              "polynomial",
+              "roots",
+              "roots",
+              "wrong",
+              "wrong",
+              "escal.",
+              "time [s]",
+              "time [s]",
+              "ratio");
+  std::printf("%-16s %6s %6s %6s %6s %8s %12s %12s %6s\n",
+              "",
+              "native",
+              "cert.",
+              "native",
+              "cert.",
+              "rate",
+              "native",
+              "cert.",
+              "");
+  char name[32];
+
+  // Clusters of four roots 1, 1 + d, 1 + 2d, 1 + 3d
+  for (Integer e : {6, 9, 11, 12}) {
+    double d{std::ldexp(1.0, -e)};
+    std::snprintf(name, sizeof(name), "cluster 2^-%d", e);
+    run(name, from_roots({1.0, 1.0 + d, 1.0 + 2 * d, 1.0 + 3 * d}),
+        1.0 - d,
+        1.0 + 4 * d);
+  }
+
+  // Wilkinson polynomials with the roots 1, 2, ..., n
+  for (Integer n : {8, 12, 16}) {
+    std::vector<double> roots;
+    for (Integer k{1}; k <= n; ++k) {
+      roots.push_back(k);
+    }
+    std::snprintf(name, sizeof(name), "wilkinson %d", n);
+    run(name, from_roots(roots), 0.5, n + 0.5);
+  }
+
+  // Random coefficients in [-1, 1]
+  for (Integer n : {10, 20, 40}) {
+    std::snprintf(name, sizeof(name), "random %d", n);
+    run(name, random(n), -2.0, 2.0);
+  }
+  return 0;
+}
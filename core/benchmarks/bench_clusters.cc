@@ -0,0 +1,146 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Product of (x - r) over the given roots
+Poly<double> from_roots(const std::vector<double> &roots) {
+  Poly<double> p(1), f(2);
+  p << 1.0;
+  for (double r : roots) {
+    f << -r, 1.0;
+    p = p * f;
+  }
+  return p;
+}
+
+// Mignotte polynomial x^n - 2 (10 x - 1)^2, with two roots closer than
+// 10^(-n/2) around 1/10
+Poly<double> mignotte(Integer n) {
+  Poly<double> p(n + 1);
+  p.setZero();
+  p.coeffRef(n) = 1.0;
+  p.coeffRef(0) -= 2.0;
+  p.coeffRef(1) += 40.0;
+  p.coeffRef(2) -= 200.0;
+  return p;
+}
+
+// Sequence evaluations and time of the root separation without and with the
+// cluster detection, averaged over a family
+void run(const char *name, const std::vector<Poly<double>> &polys) {
+  std::vector<Sequence<double>> seqs, seqs_cluster;
+  long eval_off{0}, eval_on{0}, roots_off{0}, roots_on{0}, clusters{0};
+  for (const Poly<double> &p : polys) {
+    seqs.emplace_back(p);
+    seqs_cluster.emplace_back(p);
+    Sequence<double> &seq{seqs_cluster.back()};
+    seq.set_cluster_detection(true);
+    roots_off += seqs.back().separate_roots();
+    roots_on += seq.separate_roots();
+    eval_off += seqs.back().statistics().evaluations;
+    eval_on += seq.statistics().evaluations;
+    for (Integer i{0}; i < seq.roots_number(); ++i) {
+      clusters += seq.interval(i).multiplicity > 1;
+    }
+  }
+  double t_off{Benchmark::time([&]() {
+    for (Sequence<double> &seq : seqs) {
+      Benchmark::do_not_optimize(seq.separate_roots());
+    }
+  })};
+  double t_on{Benchmark::time([&]() {
+    for (Sequence<double> &seq : seqs_cluster) {
+      Benchmark::do_not_optimize(seq.separate_roots());
+    }
+  })};
+  double n{static_cast<double>(polys.size())};
+  std::printf("%-16s %8.1f %8.1f %8.1f %8.1f %8.2f %10.3e %10.3e %8.2f\n",
+              name,
+              roots_off / n,
+              roots_on / n,
+              eval_off / n,
+              eval_on / n,
+              clusters / n,
+              t_off / n,
+              t_on / n,
+              t_off / t_on);
+}
+
+int main() {
+  constexpr Integer n_poly{100};
+  std::mt19937 &gen{Benchmark::generator()};
+  std::uniform_real_distribution<double> unit(0.0, 1.0), sym(-1.0, 1.0);
+
+  std::printf("%-16s %8s %8s %8s %8s %8s %10s %10s %8s\n",
+              "family",
+              "roots",
+              "roots",
+              "evals",
+              "evals",
+              "clusters",
+              "time [s]",
+              "time [s]",
+              "speedup");
+  std::printf("%-16s %8s %8s %8s %8s %8s %10s %10s %8s\n",
+              "",
+              "off",
+              "on",
+              "off",
+              "on",
+              "",
+              "off",
+              "on",
+              "");
+
+  // Random roots in [-1, 1], plus a pair of roots closer than the accuracy
+  // of a double root
+  for (double gap : {1.0e-8, 1.0e-9, 1.0e-10}) {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      std::vector<double> roots(6);
+      for (double &r : roots) {
+        r = sym(gen);
+      }
+      roots.push_back(roots.back() + gap * (1.0 + unit(gen)));
+      polys.push_back(from_roots(roots));
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "pair %.0e", gap);
+    run(name, polys);
+  }
+
+  // Random roots in [-1, 1] only, where no cluster is expected
+  {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      std::vector<double> roots(7);
+      for (double &r : roots) {
+        r = sym(gen);
+      }
+      polys.push_back(from_roots(roots));
+    }
+    run("separated 7", polys);
+  }
+
+  // Mignotte polynomials
+  for (Integer n : {15, 20, 30}) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "mignotte %d", n);
+    run(name, {mignotte(n)});
+  }
+  return 0;
+}
@@ -0,0 +1,159 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+constexpr Evaluation STRATEGIES[]{
+  Evaluation::NATIVE, Evaluation::COMPENSATED, Evaluation::DOUBLE_DOUBLE};
+constexpr const char *NAMES[]{"native", "compensated", "double-double"};
+
+// Product of (x - r) over the given roots
+Poly<double> from_roots(const std::vector<double> &roots) {
+  Poly<double> p(1), f(2);
+  p << 1.0;
+  for (double r : roots) {
+    f << -r, 1.0;
+    p = p * f;
+  }
+  return p;
+}
+
+// Median relative error of each strategy and time of an evaluation, on points
+// given with the exact values of the polynomial
+void run(const char *name,
+         const Poly<double> &p,
+         const std::vector<double> &x,
+         const std::vector<long double> &exact) {
+  for (Integer s{0}; s < 3; ++s) {
+    std::vector<double> errors;
+    for (std::size_t i{0}; i < x.size(); ++i) {
+      long double value{p.evaluate(x[i], STRATEGIES[s])};
+      errors.push_back(std::min(
+          1.0, static_cast<double>(std::abs(value - exact[i]) /
+                                   std::abs(exact[i]))));
+    }
+    std::nth_element(
+        errors.begin(), errors.begin() + errors.size() / 2, errors.end());
+    double t{Benchmark::time([&]() {
+      for (double x_i : x) {
+        Benchmark::do_not_optimize(p.evaluate(x_i, STRATEGIES[s]));
+      }
+    })};
+    std::printf("%-16s %-14s %12.2e %12.4e\n",
+                name,
+                NAMES[s],
+                errors[errors.size() / 2],
+                t / x.size());
+  }
+}
+
+// Wrong sign variations of the sequence on a grid of the interval, i.e.,
+// the ones that increase from left to right, and time of the sign variations
+// at a point
+void run_sequence(const char *name, const Poly<double> &p, double a, double b) {
+  constexpr Integer n_points{4000};
+  Sequence<double> seq(p);
+  for (Integer s{0}; s < 3; ++s) {
+    seq.set_evaluation(STRATEGIES[s]);
+    bool on_root;
+    Integer n_wrong{0};
+    Integer v_prev{seq.sign_variations(a, on_root)};
+    for (Integer i{1}; i <= n_points; ++i) {
+      Integer v{seq.sign_variations(a + (b - a) * i / n_points, on_root)};
+      n_wrong += v > v_prev;
+      v_prev = v;
+    }
+    double t{Benchmark::time([&]() {
+      for (Integer i{1}; i <= n_points; ++i) {
+        Benchmark::do_not_optimize(
+            seq.sign_variations(a + (b - a) * i / n_points, on_root));
+      }
+    })};
+    std::printf("%-16s %-14s %12d %12.4e\n",
+                name,
+                NAMES[s],
+                n_wrong,
+                t / n_points);
+  }
+}
+
+int main() {
+  constexpr Integer n_points{1000};
+  std::mt19937 &gen{Benchmark::generator()};
+  std::uniform_real_distribution<double> unit(-1.0, 1.0);
+  char name[32];
+
+  std::printf("%-16s %-14s %12s %12s\n",
+              "polynomial",
+              "strategy",
+              "rel. error",
+              "time [s]");
+
+  // (x - 1)^n expanded, near its root, where x - 1 is exact
+  for (Integer n : {5, 10, 15}) {
+    Poly<double> p(1), f(2);
+    p << 1.0;
+    f << -1.0, 1.0;
+    for (Integer i{0}; i < n; ++i) {
+      p = p * f;
+    }
+    std::vector<double> x;
+    std::vector<long double> exact;
+    for (Integer i{0}; i < n_points; ++i) {
+      x.push_back(1.0 + 0.1 * unit(gen));
+      exact.push_back(std::pow(static_cast<long double>(x.back() - 1.0), n));
+    }
+    std::snprintf(name, sizeof(name), "(x - 1)^%d", n);
+    run(name, p, x, exact);
+  }
+
+  // Wilkinson polynomials, near their roots
+  for (Integer n : {10, 15}) {
+    std::vector<double> roots;
+    for (Integer k{1}; k <= n; ++k) {
+      roots.push_back(k);
+    }
+    std::vector<double> x;
+    std::vector<long double> exact;
+    for (Integer i{0}; i < n_points; ++i) {
+      x.push_back(1 + (i % n) + 0.01 * unit(gen));
+      long double value{1.0};
+      for (double r : roots) {
+        value *= x.back() - static_cast<long double>(r);
+      }
+      exact.push_back(value);
+    }
+    std::snprintf(name, sizeof(name), "wilkinson %d", n);
+    run(name, from_roots(roots), x, exact);
+  }
+
+  std::printf("\n%-16s %-14s %12s %12s\n",
+              "sequence",
+              "strategy",
+              "wrong",
+              "time [s]");
+
+  // Clusters of four roots 1, 1 + d, 1 + 2d, 1 + 3d
+  for (Integer e : {9, 11, 12}) {
+    double d{std::ldexp(1.0, -e)};
+    std::snprintf(name, sizeof(name), "cluster 2^-%d", e);
+    run_sequence(name,
+                 from_roots({1.0, 1.0 + d, 1.0 + 2 * d, 1.0 + 3 * d}),
+                 1.0 - d,
+                 1.0 + 4 * d);
+  }
+  return 0;
+}
@@ -0,0 +1,90 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Time of the histogram of the roots over the slabs between the breakpoints,
+// with a root separation per slab, with a count per slab, and with a single
+// count over the breakpoints, averaged over random polynomials
+void run(Integer degree, Integer n_slabs) {
+  constexpr Integer n_poly{20};
+  std::uniform_real_distribution<double> sym(-1.0, 1.0);
+  std::vector<Sequence<double>> seqs;
+  for (Integer k{0}; k < n_poly; ++k) {
+    Poly<double> p(degree + 1);
+    for (Integer i{0}; i <= degree; ++i) {
+      p.coeffRef(i) = sym(Benchmark::generator());
+    }
+    seqs.emplace_back(p);
+  }
+  std::vector<double> x(n_slabs + 1);
+  for (Integer i{0}; i <= n_slabs; ++i) {
+    x[i] = -2.0 + 4.0 * i / n_slabs;
+  }
+  std::vector<Integer> counts(n_slabs);
+
+  double t_separate{Benchmark::time([&]() {
+    for (Sequence<double> &seq : seqs) {
+      for (Integer i{0}; i < n_slabs; ++i) {
+        counts[i] = seq.separate_roots(x[i], x[i + 1]);
+      }
+      Benchmark::do_not_optimize(counts.data());
+    }
+  })};
+  double t_pairs{Benchmark::time([&]() {
+    for (const Sequence<double> &seq : seqs) {
+      for (Integer i{0}; i < n_slabs; ++i) {
+        counts[i] = seq.count_roots(x[i], x[i + 1]);
+      }
+      Benchmark::do_not_optimize(counts.data());
+    }
+  })};
+  double t_breakpoints{Benchmark::time([&]() {
+    for (const Sequence<double> &seq : seqs) {
+      Benchmark::do_not_optimize(seq.count_roots(x, counts));
+    }
+  })};
+  double t_total{Benchmark::time([&]() {
+    for (const Sequence<double> &seq : seqs) {
+      Benchmark::do_not_optimize(seq.count_roots());
+    }
+  })};
+  std::printf("%6d %6d %12.3e %12.3e %12.3e %12.3e %8.2f\n",
+              degree,
+              n_slabs,
+              t_separate / n_poly,
+              t_pairs / n_poly,
+              t_breakpoints / n_poly,
+              t_total / n_poly,
+              t_separate / t_breakpoints);
+}
+
+int main() {
+  std::printf("%6s %6s %12s %12s %12s %12s %8s\n",
+              "degree",
+              "slabs",
+              "separate [s]",
+              "pairs [s]",
+              "breaks [s]",
+              "total [s]",
+              "speedup");
+  for (Integer degree : {10, 20, 40}) {
+    for (Integer n_slabs : {8, 64, 512}) {
+      run(degree, n_slabs);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,124 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Descartes.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Product of (x - r) over the given roots
+Poly<double> from_roots(const std::vector<double> &roots) {
+  Poly<double> p(1), f(2);
+  p << 1.0;
+  for (double r : roots) {
+    f << -r, 1.0;
+    p = p * f;
+  }
+  return p;
+}
+
+// Mignotte polynomial x^n - 2 (10 x - 1)^2, with two roots closer than
+// 10^(-n/2) around 1/10
+Poly<double> mignotte(Integer n) {
+  Poly<double> p(n + 1);
+  p.setZero();
+  p.coeffRef(n) = 1.0;
+  p.coeffRef(0) -= 2.0;
+  p.coeffRef(1) += 40.0;
+  p.coeffRef(2) -= 200.0;
+  return p;
+}
+
+// Wilkinson polynomial with the roots 1, 2, ..., n
+Poly<double> wilkinson(Integer n) {
+  std::vector<double> roots;
+  for (Integer k{1}; k <= n; ++k) {
+    roots.push_back(k);
+  }
+  return from_roots(roots);
+}
+
+// Chebyshev polynomial of the first kind T_n(x)
+Poly<double> chebyshev(Integer n) {
+  Poly<double> t_0(1), t_1(2), t_2, x(2);
+  t_0 << 1.0;
+  t_1 << 0.0, 1.0;
+  x << 0.0, 2.0;
+  for (Integer k{2}; k <= n; ++k) {
+    t_2 = x * t_1 - t_0;
+    t_0 = t_1;
+    t_1 = t_2;
+  }
+  return n == 0 ? t_0 : t_1;
+}
+
+// Polynomial with random coefficients in [-1, 1]
+Poly<double> random(Integer n) {
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  Poly<double> p(n + 1);
+  for (Integer i{0}; i <= n; ++i) {
+    p.coeffRef(i) = dist(Benchmark::generator());
+  }
+  return p;
+}
+
+// Time of the construction and root separation of both engines
+void run(const char *name, const Poly<double> &p) {
+  Integer n_seq{Sequence<double>(p).separate_roots()};
+  Integer n_des{Descartes<double>(p).separate_roots()};
+  double t_seq{Benchmark::time([&]() {
+    Sequence<double> seq(p);
+    Benchmark::do_not_optimize(seq.separate_roots());
+  })};
+  double t_des{Benchmark::time([&]() {
+    Descartes<double> des(p);
+    Benchmark::do_not_optimize(des.separate_roots());
+  })};
+  std::printf("%-16s %6d %6d %6d %14.4e %14.4e %8.2f\n",
+              name,
+              p.degree(),
+              n_seq,
+              n_des,
+              t_seq,
+              t_des,
+              t_seq / t_des);
+}
+
+int main() {
+  std::printf("%-16s %6s %6s %6s %14s %14s %8s\n",
+              "polynomial",
+              "degree",
+              "sturm",
+              "vca",
+              "sturm [s]",
+              "vca [s]",
+              "speedup");
+  char name[32];
+  for (Integer n : {10, 15, 20}) {
+    std::snprintf(name, sizeof(name), "mignotte %d", n);
+    run(name, mignotte(n));
+  }
+  for (Integer n : {10, 15}) {
+    std::snprintf(name, sizeof(name), "wilkinson %d", n);
+    run(name, wilkinson(n));
+  }
+  for (Integer n : {10, 20, 40}) {
+    std::snprintf(name, sizeof(name), "chebyshev %d", n);
+    run(name, chebyshev(n));
+  }
+  for (Integer n : {10, 20, 40, 80}) {
+    std::snprintf(name, sizeof(name), "random %d", n);
+    run(name, random(n));
+  }
+  return 0;
+}
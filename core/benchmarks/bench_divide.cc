@@ -0,0 +1,77 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Poly.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Compare the throughput of divide and GCD with and without a reusable
+// workspace, for increasing polynomial degrees
+template <typename Real>
+void run(const char *name) {
+  std::uniform_real_distribution<Real> dist(-1.0, 1.0);
+
+  std::printf("\n%s\n", name);
+  std::printf("%8s %14s %14s %8s %14s %14s %8s\n",
+              "degree",
+              "divide [op/s]",
+              "divide+ws",
+              "speedup",
+              "GCD [op/s]",
+              "GCD+ws",
+              "speedup");
+  for (Integer degree : {5, 10, 20, 50, 100, 200, 500}) {
+    Poly<Real> p_1(degree + 1), p_2(degree / 2 + 1), dp_1, q, r, gcd;
+    for (Integer i{0}; i < p_1.order(); ++i) {
+      p_1.coeffRef(i) = dist(Benchmark::generator());
+    }
+    for (Integer i{0}; i < p_2.order(); ++i) {
+      p_2.coeffRef(i) = dist(Benchmark::generator());
+    }
+    p_1.derivative(dp_1);
+    DivideWorkspace<Real> ws;
+
+    double t_divide{Benchmark::time([&]() {
+      Sturm::divide(p_1, p_2, q, r);
+      Benchmark::do_not_optimize(r.data());
+    })};
+    double t_divide_ws{Benchmark::time([&]() {
+      Sturm::divide(p_1, p_2, q, r, ws);
+      Benchmark::do_not_optimize(r.data());
+    })};
+    double t_gcd{Benchmark::time([&]() {
+      Sturm::GCD(p_1, dp_1, gcd);
+      Benchmark::do_not_optimize(gcd.data());
+    })};
+    double t_gcd_ws{Benchmark::time([&]() {
+      Sturm::GCD(p_1, dp_1, gcd, ws);
+      Benchmark::do_not_optimize(gcd.data());
+    })};
+
+    std::printf("%8d %14.4e %14.4e %8.2f %14.4e %14.4e %8.2f\n",
+                degree,
+                1.0 / t_divide,
+                1.0 / t_divide_ws,
+                t_divide / t_divide_ws,
+                1.0 / t_gcd,
+                1.0 / t_gcd_ws,
+                t_gcd / t_gcd_ws);
+  }
+}
+
+int main() {
+  run<float>("float");
+  run<double>("double");
+  return 0;
+}
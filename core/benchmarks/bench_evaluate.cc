@@ -0,0 +1,82 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Poly.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Compare the scalar Horner loop with the batched evaluation, in points per
+// second, for increasing polynomial degrees
+template <typename Real>
+void run(const char *name) {
+  constexpr Integer n_points{1 << 16};
+  std::uniform_real_distribution<Real> dist(-1.0, 1.0);
+
+  std::vector<Real> x(n_points), p(n_points), Dp(n_points);
+  for (Real &x_i : x) {
+    x_i = dist(Benchmark::generator());
+  }
+
+  std::printf("\n%s, %d points\n", name, n_points);
+  std::printf("%8s %14s %14s %8s %14s %14s %8s\n",
+              "degree",
+              "scalar [pt/s]",
+              "batch [pt/s]",
+              "speedup",
+              "scalar+D",
+              "batch+D",
+              "speedup");
+  for (Integer degree : {3, 4, 5, 6, 10, 20, 50, 100, 200}) {
+    Poly<Real> poly(degree + 1);
+    for (Integer i{0}; i <= degree; ++i) {
+      poly.coeffRef(i) = dist(Benchmark::generator());
+    }
+
+    double t_scalar{Benchmark::time([&]() {
+      for (Integer i{0}; i < n_points; ++i) {
+        p[i] = poly.evaluate(x[i]);
+      }
+      Benchmark::do_not_optimize(p.data());
+    })};
+    double t_batch{Benchmark::time([&]() {
+      poly.evaluate(x, p);
+      Benchmark::do_not_optimize(p.data());
+    })};
+    double t_scalar_D{Benchmark::time([&]() {
+      for (Integer i{0}; i < n_points; ++i) {
+        poly.evaluate(x[i], p[i], Dp[i]);
+      }
+      Benchmark::do_not_optimize(p.data());
+    })};
+    double t_batch_D{Benchmark::time([&]() {
+      poly.evaluate(x, p, Dp);
+      Benchmark::do_not_optimize(p.data());
+    })};
+
+    std::printf("%8d %14.4e %14.4e %8.2f %14.4e %14.4e %8.2f\n",
+                degree,
+                n_points / t_scalar,
+                n_points / t_batch,
+                t_scalar / t_batch,
+                n_points / t_scalar_D,
+                n_points / t_batch_D,
+                t_scalar_D / t_batch_D);
+  }
+}
+
+int main() {
+  run<float>("float");
+  run<double>("double");
+  return 0;
+}
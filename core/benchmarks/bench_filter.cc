@@ -0,0 +1,155 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Product of (x - r) over the given roots
+Poly<double> from_roots(const std::vector<double> &roots) {
+  Poly<double> p(1), f(2);
+  p << 1.0;
+  for (double r : roots) {
+    f << -r, 1.0;
+    p = p * f;
+  }
+  return p;
+}
+
+// Chebyshev polynomial of the first kind T_n(x)
+Poly<double> chebyshev(Integer n) {
+  Poly<double> t_0(1), t_1(2), t_2, x(2);
+  t_0 << 1.0;
+  t_1 << 0.0, 1.0;
+  x << 0.0, 2.0;
+  for (Integer k{2}; k <= n; ++k) {
+    t_2 = x * t_1 - t_0;
+    t_0 = t_1;
+    t_1 = t_2;
+  }
+  return t_1;
+}
+
+// Sequence evaluations and time of the root separation without and with the
+// Descartes filter, averaged over a family
+void run(const char *name, const std::vector<Poly<double>> &polys) {
+  std::vector<Sequence<double>> seqs, seqs_filter;
+  long eval_off{0}, eval_on{0}, tests{0}, saved{0};
+  for (const Poly<double> &p : polys) {
+    seqs.emplace_back(p);
+    seqs_filter.emplace_back(p);
+    seqs_filter.back().set_filter(true);
+    Integer n_off{seqs.back().separate_roots()};
+    Integer n_on{seqs_filter.back().separate_roots()};
+    const Sequence<double>::Statistics &stats{
+      seqs_filter.back().statistics()};
+    eval_off += seqs.back().statistics().evaluations;
+    eval_on += stats.evaluations;
+    tests += stats.filter_tests;
+    saved += stats.filtered;
+    if (n_off != n_on) {
+      std::printf("%s: %d roots without the filter, %d with it\n",
+                  name,
+                  n_off,
+                  n_on);
+    }
+  }
+  double t_off{Benchmark::time([&]() {
+    for (Sequence<double> &seq : seqs) {
+      Benchmark::do_not_optimize(seq.separate_roots());
+    }
+  })};
+  double t_on{Benchmark::time([&]() {
+    for (Sequence<double> &seq : seqs_filter) {
+      Benchmark::do_not_optimize(seq.separate_roots());
+    }
+  })};
+  double n{static_cast<double>(polys.size())};
+  std::printf("%-16s %8.1f %8.1f %8.1f %8.1f %10.3e %10.3e %8.2f\n",
+              name,
+              eval_off / n,
+              eval_on / n,
+              tests / n,
+              saved / n,
+              t_off / n,
+              t_on / n,
+              t_off / t_on);
+}
+
+int main() {
+  constexpr Integer n_poly{100};
+  std::mt19937 &gen{Benchmark::generator()};
+  std::uniform_real_distribution<double> unit(0.0, 1.0), sym(-1.0, 1.0);
+
+  std::printf("%-16s %8s %8s %8s %8s %10s %10s %8s\n",
+              "family",
+              "evals",
+              "evals",
+              "tests",
+              "saved",
+              "time [s]",
+              "time [s]",
+              "speedup");
+  std::printf("%-16s %8s %8s %8s %8s %10s %10s %8s\n",
+              "",
+              "off",
+              "on",
+              "",
+              "",
+              "off",
+              "on",
+              "");
+
+  // Random coefficients in [-1, 1]
+  for (Integer degree : {10, 20, 40}) {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      Poly<double> p(degree + 1);
+      for (Integer i{0}; i <= degree; ++i) {
+        p.coeffRef(i) = sym(gen);
+      }
+      polys.push_back(p);
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "random %d", degree);
+    run(name, polys);
+  }
+
+  // Random roots in [-1, 1]
+  for (Integer degree : {8, 16}) {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      std::vector<double> roots(degree);
+      for (double &r : roots) {
+        r = sym(gen);
+      }
+      polys.push_back(from_roots(roots));
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "roots %d", degree);
+    run(name, polys);
+  }
+
+  // Wilkinson and Chebyshev polynomials
+  {
+    std::vector<double> roots;
+    for (Integer k{1}; k <= 12; ++k) {
+      roots.push_back(k);
+    }
+    run("wilkinson 12", {from_roots(roots)});
+    run("chebyshev 20", {chebyshev(20)});
+    run("chebyshev 40", {chebyshev(40)});
+  }
+  return 0;
+}
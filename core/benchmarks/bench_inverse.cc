@@ -0,0 +1,70 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Poly.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Compare the throughput of the workspace division, which switches to the
+// Newton inversion above STURM_NEWTON_DIVIDE_THRESHOLD, with the division by a
+// divisor whose inverse is computed at each call or once for all dividends
+template <typename Real>
+void run(const char *name) {
+  std::uniform_real_distribution<Real> dist(-1.0, 1.0);
+
+  std::printf("\n%s (threshold %d)\n", name, STURM_NEWTON_DIVIDE_THRESHOLD);
+  std::printf("%8s %14s %14s %14s\n",
+              "degree",
+              "divide [op/s]",
+              "inverse+div",
+              "div");
+  for (Integer degree : {50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000}) {
+    Poly<Real> p_1(degree + 1), p_2(degree / 2 + 1), q, r;
+    for (Integer i{0}; i < p_1.order(); ++i) {
+      p_1.coeffRef(i) = dist(Benchmark::generator());
+    }
+    for (Integer i{0}; i < p_2.order(); ++i) {
+      p_2.coeffRef(i) = dist(Benchmark::generator());
+    }
+    p_2.coeffRef(p_2.order() - 1) = 1.0;
+    DivideWorkspace<Real> ws;
+    Divisor<Real> div(p_2, p_1.order());
+
+    double t_divide{Benchmark::time([&]() {
+      Sturm::divide(p_1, p_2, q, r, ws);
+      Benchmark::do_not_optimize(r.data());
+    })};
+    double t_inverse{Benchmark::time([&]() {
+      Divisor<Real> div_tmp(p_2, p_1.order());
+      Sturm::divide(p_1, div_tmp, q, r);
+      Benchmark::do_not_optimize(r.data());
+    })};
+    double t_div{Benchmark::time([&]() {
+      Sturm::divide(p_1, div, q, r);
+      Benchmark::do_not_optimize(r.data());
+    })};
+
+    std::printf("%8d %14.4e %14.4e %14.4e\n",
+                degree,
+                1.0 / t_divide,
+                1.0 / t_inverse,
+                1.0 / t_div);
+  }
+}
+
+int main() {
+  run<float>("float");
+  run<double>("double");
+  return 0;
+}
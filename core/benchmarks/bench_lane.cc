@@ -0,0 +1,112 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/LaneSolver.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Illinois root solver, the same method used by the lane-parallel refinement
+template <typename Real>
+bool illinois(Real a, Real b, std::function<Real(Real)> f, Real &x) {
+  Real fa{f(a)}, fb{f(b)};
+  if (fa == 0) {
+    fa = -fb;
+  }
+  for (int i{0}, side{0}; i < 200; ++i) {
+    Real s{(a * fb - b * fa) / (fb - fa)};
+    x = i % 4 != 3 && s > a && s < b ? s : (a + b) / 2;
+    Real fx{f(x)};
+    if (fx == 0) {
+      return true;
+    }
+    if ((fx > 0) == (fa > 0)) {
+      fb = side < 0 ? fb / 2 : fb;
+      a  = x;
+      fa = fx;
+      side = -1;
+    } else {
+      fa = side > 0 ? fa / 2 : fa;
+      b  = x;
+      fb = fx;
+      side = 1;
+    }
+    if (b - a <= 4 * std::numeric_limits<Real>::epsilon() *
+                     std::max({Real(1.0), std::abs(a), std::abs(b)})) {
+      x = (a + b) / 2;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Compare the throughput of a scalar loop over the polynomials, with a
+// fixed-degree Sturm sequence rebuilt in place, with the lane-parallel solver
+template <typename Real, Integer Degree>
+void run(const char *name) {
+  constexpr Integer n_poly{10000};
+  std::uniform_real_distribution<Real> dist(-1.0, 1.0);
+  std::vector<Poly<Real, Degree>> polys(n_poly, Poly<Real, Degree>(Degree + 1));
+  for (Poly<Real, Degree> &p : polys) {
+    for (Integer i{0}; i <= Degree; ++i) {
+      p.coeffRef(i) = dist(Benchmark::generator());
+    }
+  }
+
+  Sequence<Real, Degree> seq;
+  double t_scalar{Benchmark::time([&]() {
+    for (const Poly<Real, Degree> &p : polys) {
+      seq.build(p);
+      seq.separate_roots();
+      typename Sequence<Real, Degree>::Vector roots{
+          seq.refine_roots(illinois<Real>)};
+      Benchmark::do_not_optimize(roots.data());
+    }
+  })};
+  LaneSolver<Real, Degree, 4> solver_4;
+  double t_4{Benchmark::time(
+      [&]() { Benchmark::do_not_optimize(solver_4.solve(polys)); })};
+  LaneSolver<Real, Degree, 8> solver_8;
+  double t_8{Benchmark::time(
+      [&]() { Benchmark::do_not_optimize(solver_8.solve(polys)); })};
+  LaneSolver<Real, Degree, 16> solver_16;
+  double t_16{Benchmark::time(
+      [&]() { Benchmark::do_not_optimize(solver_16.solve(polys)); })};
+
+  std::printf("%-8s %8d %14.4e %14.4e %14.4e %14.4e %8.2f\n",
+              name,
+              Degree,
+              n_poly / t_scalar,
+              n_poly / t_4,
+              n_poly / t_8,
+              n_poly / t_16,
+              t_scalar / std::min({t_4, t_8, t_16}));
+}
+
+int main() {
+  std::printf("%-8s %8s %14s %14s %14s %14s %8s\n",
+              "type",
+              "degree",
+              "scalar [poly/s]",
+              "4 lanes",
+              "8 lanes",
+              "16 lanes",
+              "speedup");
+  run<float, 3>("float");
+  run<float, 5>("float");
+  run<float, 8>("float");
+  run<double, 3>("double");
+  run<double, 5>("double");
+  run<double, 8>("double");
+  return 0;
+}
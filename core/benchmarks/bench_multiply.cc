@@ -0,0 +1,70 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Poly.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Compare the throughput of the schoolbook, Karatsuba and FFT products of two
+// polynomials of the same order, to locate the crossover thresholds
+template <typename Real>
+void run(const char *name) {
+  std::uniform_real_distribution<Real> dist(-1.0, 1.0);
+
+  std::printf("\n%s\n", name);
+  std::printf("%8s %14s %14s %14s %14s\n",
+              "order",
+              "school [op/s]",
+              "karatsuba",
+              "fft",
+              "multiply");
+  for (Integer order : {8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096}) {
+    Poly<Real> p_1(order), p_2(order), c(2 * order - 1);
+    for (Integer i{0}; i < order; ++i) {
+      p_1.coeffRef(i) = dist(Benchmark::generator());
+      p_2.coeffRef(i) = dist(Benchmark::generator());
+    }
+    const Real *a{p_1.data()}, *b{p_2.data()};
+
+    double t_school{Benchmark::time([&]() {
+      Sturm::multiply_schoolbook(a, order, b, order, c.data());
+      Benchmark::do_not_optimize(c.data());
+    })};
+    double t_karatsuba{Benchmark::time([&]() {
+      Sturm::multiply_karatsuba(a, order, b, order, c.data());
+      Benchmark::do_not_optimize(c.data());
+    })};
+    double t_fft{Benchmark::time([&]() {
+      Sturm::multiply_fft(a, order, b, order, c.data());
+      Benchmark::do_not_optimize(c.data());
+    })};
+    double t_multiply{Benchmark::time([&]() {
+      Sturm::multiply(a, order, b, order, c.data());
+      Benchmark::do_not_optimize(c.data());
+    })};
+
+    std::printf("%8d %14.4e %14.4e %14.4e %14.4e\n",
+                order,
+                1.0 / t_school,
+                1.0 / t_karatsuba,
+                1.0 / t_fft,
+                1.0 / t_multiply);
+  }
+}
+
+int main() {
+  run<float>("float");
+  run<double>("double");
+  return 0;
+}
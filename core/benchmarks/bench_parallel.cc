@@ -0,0 +1,104 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Bisection root solver, which keeps no state and can be called concurrently
+template <typename Real>
+bool bisection(Real a, Real b, std::function<Real(Real)> f, Real &x) {
+  Real fa{f(a)};
+  for (int i{0}; i < 200; ++i) {
+    x = (a + b) / 2;
+    if (x <= a || x >= b) {
+      return true;
+    }
+    Real fx{f(x)};
+    if (fx == 0) {
+      return true;
+    }
+    if ((fa < 0) == (fx < 0)) {
+      a  = x;
+      fa = fx;
+    } else {
+      b = x;
+    }
+  }
+  return false;
+}
+
+// Time the separation and the refinement of the roots of a polynomial, serially
+// and in parallel for an increasing number of threads
+template <typename Real>
+void run(const char *label, const Poly<Real> &p) {
+  Sequence<Real> seq(p);
+  Integer n_roots{seq.separate_roots()};
+  Real a{seq.a()}, b{seq.b()};
+  Integer n_max{std::max(
+      static_cast<Integer>(std::thread::hardware_concurrency()), Integer(4))};
+
+  std::printf("%-12s %8d %8d", label, p.degree(), n_roots);
+  double t_serial{Benchmark::time([&]() {
+    seq.separate_roots(a, b);
+    typename Sequence<Real>::Vector roots{seq.refine_roots(bisection<Real>)};
+    Benchmark::do_not_optimize(roots.data());
+  })};
+  std::printf(" %12.4e", 1.0 / t_serial);
+  for (Integer n_threads{1}; n_threads <= n_max; n_threads *= 2) {
+    ThreadPool pool(n_threads);
+    double t{Benchmark::time([&]() {
+      seq.separate_roots(a, b, pool);
+      typename Sequence<Real>::Vector roots{
+          seq.refine_roots(bisection<Real>, pool)};
+      Benchmark::do_not_optimize(roots.data());
+    })};
+    std::printf(" %4d:%5.2fx", n_threads, t_serial / t);
+  }
+  std::printf("\n");
+}
+
+int main() {
+  using Real = double;
+  std::uniform_real_distribution<Real> dist(-1.0, 1.0);
+
+  std::printf("threads: %u\n", std::thread::hardware_concurrency());
+  std::printf("%-12s %8s %8s %12s %s\n",
+              "polynomial",
+              "degree",
+              "roots",
+              "serial [op/s]",
+              "speedup by threads");
+
+  // Products of linear factors at the Chebyshev nodes, with all real roots
+  for (Integer degree : {10, 20, 30}) {
+    Poly<Real> p(1), f(2);
+    p << 1.0;
+    for (Integer i{0}; i < degree; ++i) {
+      f << -std::cos(std::numbers::pi * (i + 0.5) / degree), 1.0;
+      p *= f;
+    }
+    run<Real>("chebyshev", p);
+  }
+
+  // Random coefficients, with few real roots but costly sign variations
+  for (Integer degree : {100, 200, 400}) {
+    Poly<Real> p(degree + 1);
+    for (Integer i{0}; i <= degree; ++i) {
+      p.coeffRef(i) = dist(Benchmark::generator());
+    }
+    run<Real>("random", p);
+  }
+  return 0;
+}
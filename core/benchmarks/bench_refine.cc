@@ -0,0 +1,190 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Secant root solver of the tests, with the signature `bool(Real a, Real b,
+// std::function<Real(Real)> f, Real & x)`
+template <typename Real>
+bool secant(Real a, Real b, std::function<Real(Real)> f, Real &x) {
+  Real tolerance{1.0e-12};
+  Real fa{f(a)}, fb{f(b)};
+  if (std::abs(fa) < tolerance) {
+    x = a;
+    return true;
+  }
+  if (std::abs(fb) < tolerance) {
+    x = b;
+    return true;
+  }
+  if (fa * fb > 0) {
+    return false;
+  }
+  for (int i{0}; i < 1000; ++i) {
+    x = a - fa * (b - a) / (fb - fa);
+    Real fx{f(x)};
+    if (std::abs(fx) < tolerance) {
+      return true;
+    }
+    if (fa * fx < 0) {
+      b  = x;
+      fb = fx;
+    } else {
+      a  = x;
+      fa = fx;
+    }
+  }
+  return false;
+}
+
+// Polynomial counting its evaluations, a joint evaluation of the polynomial
+// and its derivative counts as one
+template <typename Real>
+struct Counted {
+  const Poly<Real> &p;
+  mutable long count{0};
+  Real evaluate(Real x) const {
+    ++this->count;
+    return this->p.evaluate(x);
+  }
+  void evaluate(Real x, Real &f, Real &Df) const {
+    ++this->count;
+    this->p.evaluate(x, f, Df);
+  }
+};
+
+// Evaluations per root and time per root of a refiner over all the isolating
+// intervals of a set of sequences
+template <typename Refine>
+void run(const char *name,
+         std::vector<Sequence<double>> &seqs,
+         long n_roots,
+         Refine &&refine) {
+  long count{0};
+  for (Sequence<double> &seq : seqs) {
+    Counted<double> f{seq.get(0)};
+    for (Integer i{0}; i < seq.roots_number(); ++i) {
+      const Sequence<double>::Interval &I{seq.interval(i)};
+      double x;
+      if constexpr (requires { refine.solve(I.a, I.b, f, x); }) {
+        refine.solve(I.a, I.b, f, x);
+      } else {
+        refine(I.a,
+               I.b,
+               std::function<double(double)>(
+                   [&f](double y) { return f.evaluate(y); }),
+               x);
+      }
+    }
+    count += f.count;
+  }
+  double t{Benchmark::time([&]() {
+    for (Sequence<double> &seq : seqs) {
+      Benchmark::do_not_optimize(seq.refine_roots(refine));
+    }
+  })};
+  std::printf("%-8s %16.2f %16.4e\n",
+              name,
+              static_cast<double>(count) / static_cast<double>(n_roots),
+              t / static_cast<double>(n_roots));
+}
+
+// Bisection of a bracket where the polynomial changes sign, down to the
+// width of the quadratic interval refinement
+template <typename Real>
+bool bisection(Real &a, Real &b, const Counted<Real> &f, const QIR<Real> &qir) {
+  Real fa{f.evaluate(a)};
+  f.evaluate(b);
+  while (b - a > qir.tolerance(a, b)) {
+    Real c{(a + b) / 2}, fc{f.evaluate(c)};
+    if (fc == 0) {
+      a = b = c;
+    } else if ((fc > 0) == (fa > 0)) {
+      a  = c;
+      fa = fc;
+    } else {
+      b = c;
+    }
+  }
+  return true;
+}
+
+// Evaluations per root of the certified brackets of a given width, by
+// bisection and by quadratic interval refinement
+void run_brackets(const char *name,
+                  std::vector<Sequence<double>> &seqs,
+                  long n_roots,
+                  const QIR<double> &qir) {
+  long count_bisection{0}, count_qir{0};
+  for (Sequence<double> &seq : seqs) {
+    Counted<double> f_bisection{seq.get(0)}, f_qir{seq.get(0)};
+    for (Integer i{0}; i < seq.roots_number(); ++i) {
+      const Sequence<double>::Interval &I{seq.interval(i)};
+      double a{I.a}, b{I.b};
+      bisection(a, b, f_bisection, qir);
+      a = I.a;
+      b = I.b;
+      qir.bracket(a, b, f_qir);
+    }
+    count_bisection += f_bisection.count;
+    count_qir += f_qir.count;
+  }
+  double n{static_cast<double>(n_roots)};
+  std::printf("%-8s %16.2f %16.2f\n",
+              name,
+              static_cast<double>(count_bisection) / n,
+              static_cast<double>(count_qir) / n);
+}
+
+int main() {
+  constexpr Integer n_poly{200};
+  std::printf("%-8s %16s %16s\n", "solver", "evals per root", "time [s/root]");
+  for (Integer degree : {5, 10, 20}) {
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<Sequence<double>> seqs;
+    long n_roots{0};
+    for (Integer i{0}; i < n_poly; ++i) {
+      Poly<double> p(degree + 1);
+      for (Integer j{0}; j <= degree; ++j) {
+        p.coeffRef(j) = dist(Benchmark::generator());
+      }
+      seqs.emplace_back(p);
+      n_roots += seqs.back().separate_roots();
+    }
+    std::printf("degree %d, %ld roots\n", degree, n_roots);
+    // The secant goes through a std::function, as the lambda path of
+    // Sequence::refine_roots does
+    run("secant",
+        seqs,
+        n_roots,
+        [](double a, double b, std::function<double(double)> f, double &x) {
+          return secant<double>(a, b, f, x);
+        });
+    run("newton", seqs, n_roots, Newton<double>());
+    run("brent", seqs, n_roots, Brent<double>());
+    run("itp", seqs, n_roots, ITP<double>());
+    run("qir", seqs, n_roots, QIR<double>());
+
+    // Certified brackets
+    std::printf("%-8s %16s %16s\n", "width", "bisection", "qir");
+    Tolerance<double> tolerance;
+    tolerance.absolute = 1.0e-6;
+    run_brackets("1e-6", seqs, n_roots, QIR<double>(tolerance));
+    tolerance.absolute = 0.0;
+    run_brackets("4 ulps", seqs, n_roots, QIR<double>(tolerance));
+  }
+  return 0;
+}
@@ -0,0 +1,153 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Sequence.hh"
+
+// Benchmark utilities
+#include "Benchmark.hh"
+
+using namespace Sturm;
+
+// Product of (x - r) over the given roots
+Poly<double> from_roots(const std::vector<double> &roots) {
+  Poly<double> p(1), f(2);
+  p << 1.0;
+  for (double r : roots) {
+    f << -r, 1.0;
+    p = p * f;
+  }
+  return p;
+}
+
+// Chebyshev polynomial of the first kind T_n(x)
+Poly<double> chebyshev(Integer n) {
+  Poly<double> t_0(1), t_1(2), t_2, x(2);
+  t_0 << 1.0;
+  t_1 << 0.0, 1.0;
+  x << 0.0, 2.0;
+  for (Integer k{2}; k <= n; ++k) {
+    t_2 = x * t_1 - t_0;
+    t_0 = t_1;
+    t_1 = t_2;
+  }
+  return t_1;
+}
+
+// Sequence evaluations and time of the smallest root in [a, b], from the
+// whole root separation and from the lazy search, averaged over a family
+void run(const char *name,
+         const std::vector<Poly<double>> &polys,
+         double a,
+         double b) {
+  std::vector<Sequence<double>> seqs;
+  long roots{0}, eval_all{0}, eval_first{0};
+  for (const Poly<double> &p : polys) {
+    seqs.emplace_back(p);
+    Sequence<double> &seq{seqs.back()};
+    roots += seq.separate_roots(a, b);
+    eval_all += seq.statistics().evaluations;
+    Sequence<double>::Search search{seq.search(a, b)};
+    double r;
+    search.next_root(Newton<double>(), r);
+    eval_first += search.statistics().evaluations;
+  }
+  Newton<double> newton;
+  double t_all{Benchmark::time([&]() {
+    for (Sequence<double> &seq : seqs) {
+      double r{b};
+      if (seq.separate_roots(a, b) > 0) {
+        const Sequence<double>::Interval &I{seq.interval(0)};
+        r = I.a_on_root ? I.a : (I.b_on_root ? I.b : r);
+        if (!I.a_on_root && !I.b_on_root) {
+          refine_root(newton, I.a, I.b, seq.get(0), r);
+        }
+      }
+      Benchmark::do_not_optimize(r);
+    }
+  })};
+  double t_first{Benchmark::time([&]() {
+    for (const Sequence<double> &seq : seqs) {
+      double r{b};
+      seq.search(a, b).next_root(newton, r);
+      Benchmark::do_not_optimize(r);
+    }
+  })};
+  double n{static_cast<double>(polys.size())};
+  std::printf("%-16s %8.1f %8.1f %8.1f %10.3e %10.3e %8.2f\n",
+              name,
+              roots / n,
+              eval_all / n,
+              eval_first / n,
+              t_all / n,
+              t_first / n,
+              t_all / t_first);
+}
+
+int main() {
+  constexpr Integer n_poly{100};
+  std::mt19937 &gen{Benchmark::generator()};
+  std::uniform_real_distribution<double> unit(0.0, 1.0), sym(-1.0, 1.0);
+
+  std::printf("%-16s %8s %8s %8s %10s %10s %8s\n",
+              "family",
+              "roots",
+              "evals",
+              "evals",
+              "time [s]",
+              "time [s]",
+              "speedup");
+  std::printf("%-16s %8s %8s %8s %10s %10s %8s\n",
+              "",
+              "",
+              "all",
+              "first",
+              "all",
+              "first",
+              "");
+
+  // Random coefficients in [-1, 1]
+  for (Integer degree : {10, 20, 40}) {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      Poly<double> p(degree + 1);
+      for (Integer i{0}; i <= degree; ++i) {
+        p.coeffRef(i) = sym(gen);
+      }
+      polys.push_back(p);
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "random %d", degree);
+    run(name, polys, -2.0, 2.0);
+  }
+
+  // Roots in [0, 1], as the times of contact of a collision query
+  for (Integer degree : {6, 12}) {
+    std::vector<Poly<double>> polys;
+    for (Integer k{0}; k < n_poly; ++k) {
+      std::vector<double> roots(degree);
+      for (double &r : roots) {
+        r = unit(gen);
+      }
+      polys.push_back(from_roots(roots));
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "contact %d", degree);
+    run(name, polys, 0.0, 1.0);
+  }
+
+  // Chebyshev polynomials
+  for (Integer degree : {20, 40}) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "chebyshev %d", degree);
+    run(name, {chebyshev(degree)}, -1.5, 1.5);
+  }
+  return 0;
+}
@@ -17,9 +17,24 @@
 
 // C++ standard libraries
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <span>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 // Eigen library
@@ -62,6 +77,26 @@
 #define STURM_DEFAULT_INTEGER_TYPE int
 #endif
 
+// Minimum operand order for the Karatsuba polynomial multiplication
+#ifndef STURM_KARATSUBA_THRESHOLD
+#define STURM_KARATSUBA_THRESHOLD 128
+#endif
+
+// Minimum operand order for the FFT polynomial multiplication
+#ifndef STURM_FFT_THRESHOLD
+#define STURM_FFT_THRESHOLD 1024
+#endif
+
+// Minimum quotient and remainder order for the Newton polynomial division
+#ifndef STURM_NEWTON_DIVIDE_THRESHOLD
+#define STURM_NEWTON_DIVIDE_THRESHOLD 4096
+#endif
+
+// Spread of the coefficient ratios above which the sharper root bounds are used
+#ifndef STURM_ROOT_BOUNDS_SPREAD
+#define STURM_ROOT_BOUNDS_SPREAD 64
+#endif
+
 /**
  * \brief Namespace for the Sturm library.
  *
@@ -0,0 +1,305 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef INCLUDE_STURM_BATCHSOLVER_HH
+#define INCLUDE_STURM_BATCHSOLVER_HH
+
+#include "Sturm.hh"
+#include "Sturm/Poly.hh"
+#include "Sturm/Sequence.hh"
+#include "Sturm/ThreadPool.hh"
+
+namespace Sturm {
+
+  /**
+   * \brief Batch root solver class.
+   *
+   * This class isolates and refines the real roots of many independent
+   * polynomials on a thread pool. The polynomials are split into chunks of
+   * consecutive indices, which are handed out to the threads of the pool. Each
+   * chunk takes a Sturm sequence and a polynomial buffer from a free list of
+   * the solver, which are rebuilt in place for every polynomial, so that the
+   * workspaces are allocated only once per concurrent chunk, whatever the
+   * threads that run the chunks, e.g., other threads waiting on the same
+   * pool. The roots are returned in a compressed sparse row layout: the
+   * roots of the \f$ i \f$-th polynomial are the entries from \c offsets[i] to
+   * \c offsets[i+1] (excluded) of a single flat vector, sorted in ascending
+   * order.
+   * \tparam Real Scalar number type.
+   * \tparam MaxDegree Maximum degree of the polynomials (\c Eigen::Dynamic for
+   * no limit).
+   */
+  template <typename Real, Integer MaxDegree = Eigen::Dynamic>
+  class BatchSolver {
+   public:
+    using Matrix = Eigen::Matrix<Real,
+                                 Eigen::Dynamic,
+                                 Eigen::Dynamic,
+                                 Eigen::ColMajor,
+                                 Poly<Real, MaxDegree>::MAX_ORDER,
+                                 Eigen::Dynamic>; /**< Coefficient matrix. */
+
+   private:
+    using Workspace = struct Workspace {
+      Poly<Real, MaxDegree> poly;         /**< Polynomial buffer. */
+      Sequence<Real, MaxDegree> sequence; /**< Sturm sequence. */
+    }; /**< Workspace of a thread. */
+
+    ThreadPool &m_pool; /**< Thread pool. */
+    Integer m_chunk_size{
+      64}; /**< Number of polynomials handed out to a thread at once. */
+    std::vector<std::unique_ptr<Workspace>>
+        m_workspaces; /**< Workspaces, one per concurrent chunk. */
+    std::vector<Workspace *> m_idle; /**< Workspaces not in use. */
+    std::mutex m_mutex;              /**< Mutex guarding the free list. */
+    std::vector<std::vector<Real>> m_chunk_roots; /**< Roots of each chunk. */
+    std::vector<Integer> m_offsets; /**< Offsets of the roots of each
+                                       polynomial. */
+    std::vector<Real> m_roots;      /**< Roots of all the polynomials. */
+    std::atomic<Integer> m_failures{0}; /**< Number of failed refinements. */
+    bool m_clusters{false}; /**< True if the cluster detection is enabled. */
+
+    /**
+     * \brief Solve a batch of polynomials.
+     * \param[in] n_poly Number of polynomials.
+     * \param[in] load Function returning the \f$ i \f$-th polynomial without
+     * leading zeros, possibly copied into the given buffer.
+     * \param[in] solve_function Root solver, see \c Sturm::refine_root(...).
+     * \return The total number of roots found.
+     * \tparam Load Callable with the signature `const Poly &(Integer i, Poly &
+     * buffer)`.
+     * \tparam SolveFunction Refiner with the member `bool solve(Real a, Real b,
+     * const Poly &p, Real & x) const`, or lambda function with the signature
+     * `bool(Real a, Real b, std::function<Real(Real)> f, Real & x)`.
+     */
+    template <typename Load, typename SolveFunction>
+    Integer solve_batch(Integer n_poly,
+                        Load &&load,
+                        SolveFunction &&solve_function) {
+      Integer n_chunks{(n_poly + this->m_chunk_size - 1) / this->m_chunk_size};
+      this->m_chunk_roots.resize(n_chunks);
+      this->m_offsets.assign(n_poly + 1, 0);
+      this->m_failures = 0;
+
+      this->m_pool.parallel_for(n_chunks, [&](Integer k) {
+        Workspace &ws{this->acquire()};
+        ws.sequence.set_cluster_detection(this->m_clusters);
+        std::vector<Real> &roots{this->m_chunk_roots[k]};
+        roots.clear();
+        Integer i_end{std::min(n_poly, (k + 1) * this->m_chunk_size)};
+        for (Integer i{k * this->m_chunk_size}; i < i_end; ++i) {
+          const Poly<Real, MaxDegree> &p{load(i, ws.poly)};
+          Integer n_roots{0};
+          if (p.degree() > 0) {
+            ws.sequence.build(p);
+            Integer n_intervals{ws.sequence.separate_roots()};
+            for (Integer j{0}; j < n_intervals; ++j) {
+              const typename Sequence<Real, MaxDegree>::Interval &I{
+                ws.sequence.interval(j)};
+              Real r{I.a};
+              Integer n_copies{1};
+              if (I.b_on_root) {
+                r = I.b;
+              } else if (I.multiplicity > 1) {
+                // A cluster is reported at its centre once per real root
+                r        = (I.a + I.b) / 2.0;
+                n_copies = std::abs(I.va - I.vb);
+              } else if (!I.a_on_root &&
+                         !Sturm::refine_root(solve_function, I.a, I.b, p, r)) {
+                ++this->m_failures;
+              }
+              roots.insert(roots.end(), n_copies, r);
+              n_roots += n_copies;
+            }
+          }
+          this->m_offsets[i + 1] = n_roots;
+        }
+        this->release(ws);
+      });
+
+      // Turn the counts into offsets and gather the roots of the chunks
+      for (Integer i{0}; i < n_poly; ++i) {
+        this->m_offsets[i + 1] += this->m_offsets[i];
+      }
+      this->m_roots.resize(this->m_offsets[n_poly]);
+      auto it{this->m_roots.begin()};
+      for (const std::vector<Real> &roots : this->m_chunk_roots) {
+        it = std::copy(roots.begin(), roots.end(), it);
+      }
+      return this->m_offsets[n_poly];
+    }
+
+    /**
+     * \brief Take a workspace from the free list, creating it if needed.
+     * \return The workspace, to be given back by \c release(...).
+     */
+    Workspace &acquire() {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      if (this->m_idle.empty()) {
+        this->m_workspaces.push_back(std::make_unique<Workspace>());
+        return *this->m_workspaces.back();
+      }
+      Workspace *ws{this->m_idle.back()};
+      this->m_idle.pop_back();
+      return *ws;
+    }
+
+    /**
+     * \brief Give a workspace back to the free list.
+     * \param[in] ws Workspace taken by \c acquire().
+     */
+    void release(Workspace &ws) {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_idle.push_back(&ws);
+    }
+
+   public:
+    /**
+     * \brief Class constructor for the batch solver.
+     * \param[in] pool Thread pool.
+     * \param[in] chunk_size Number of polynomials handed out to a thread at
+     * once.
+     */
+    explicit BatchSolver(ThreadPool &pool, Integer chunk_size = 64)
+        : m_pool(pool), m_chunk_size(std::max(chunk_size, Integer(1))) {}
+
+    /**
+     * \brief Isolate and refine the real roots of a batch of polynomials.
+     * \param[in] polys Polynomials.
+     * \param[in] solve_function Root solver, see \c Sturm::refine_root(...),
+     * which is called from several threads at once.
+     * \return The total number of roots found.
+     * \tparam SolveFunction Refiner with the member `bool solve(Real a, Real b,
+     * const Poly &p, Real & x) const`, or lambda function with the signature
+     * `bool(Real a, Real b, std::function<Real(Real)> f, Real & x)`.
+     */
+    template <typename SolveFunction>
+    Integer solve(std::span<const Poly<Real, MaxDegree>> polys,
+                  SolveFunction &&solve_function) {
+      return this->solve_batch(
+          static_cast<Integer>(polys.size()),
+          [polys](Integer i, Poly<Real, MaxDegree> &p)
+              -> const Poly<Real, MaxDegree> & {
+            if (polys[i].order() == 0 || polys[i].leading_coeff() != 0) {
+              return polys[i];
+            }
+            p = polys[i];
+            p.adjust_degree();
+            return p;
+          },
+          solve_function);
+    }
+
+    /**
+     * \brief Isolate and refine the real roots of a batch of polynomials
+     * stored in a coefficient matrix.
+     * \param[in] coeffs Coefficient matrix, whose \f$ (k, i) \f$ entry is the
+     * \f$ k \f$-th coefficient of the \f$ i \f$-th polynomial.
+     * \param[in] degrees Degrees of the polynomials.
+     * \param[in] solve_function Root solver, see \c Sturm::refine_root(...),
+     * which is called from several threads at once.
+     * \return The total number of roots found.
+     * \tparam SolveFunction Refiner with the member `bool solve(Real a, Real b,
+     * const Poly &p, Real & x) const`, or lambda function with the signature
+     * `bool(Real a, Real b, std::function<Real(Real)> f, Real & x)`.
+     */
+    template <typename SolveFunction>
+    Integer solve(const Matrix &coeffs,
+                  std::span<const Integer> degrees,
+                  SolveFunction &&solve_function) {
+      STURM_ASSERT(static_cast<Integer>(degrees.size()) == coeffs.cols(),
+                   "Sturm::BatchSolver::solve(...): number of degrees and "
+                   "polynomials do not match.");
+      return this->solve_batch(
+          static_cast<Integer>(degrees.size()),
+          [&coeffs, degrees](Integer i, Poly<Real, MaxDegree> &p)
+              -> const Poly<Real, MaxDegree> & {
+            Integer order{std::min(degrees[i] + 1, Integer(coeffs.rows()))};
+            p.set_order(order);
+            p.head(order) = coeffs.col(i).head(order);
+            p.adjust_degree();
+            return p;
+          },
+          solve_function);
+    }
+
+    /**
+     * \brief Enable or disable the cluster detection of the root separation.
+     *
+     * See \c Sequence::set_cluster_detection(...). A cluster is reported at
+     * the centre of its interval, repeated once per distinct real root that
+     * it holds, so that the offsets still count all the real roots.
+     * \param[in] clusters True to enable the detection.
+     */
+    void set_cluster_detection(bool clusters) {
+      this->m_clusters = clusters;
+    }
+
+    /**
+     * \brief Check if the cluster detection of the root separation is
+     * enabled.
+     * \return True if the detection is enabled.
+     */
+    bool cluster_detection() const {
+      return this->m_clusters;
+    }
+
+    /**
+     * \brief Get the number of polynomials of the last batch.
+     * \return The number of polynomials.
+     */
+    Integer size() const {
+      return std::max(static_cast<Integer>(this->m_offsets.size()) - 1,
+                      Integer(0));
+    }
+
+    /**
+     * \brief Get the offsets of the roots of each polynomial.
+     * \return The offsets, of size \c size() + 1.
+     */
+    std::span<const Integer> offsets() const {
+      return this->m_offsets;
+    }
+
+    /**
+     * \brief Get the roots of all the polynomials.
+     * \return The flat vector of the roots.
+     */
+    std::span<const Real> roots() const {
+      return this->m_roots;
+    }
+
+    /**
+     * \brief Get the roots of the \f$ i \f$-th polynomial.
+     * \param[in] i Index of the polynomial.
+     * \return The roots of the \f$ i \f$-th polynomial.
+     */
+    std::span<const Real> roots(Integer i) const {
+      return std::span<const Real>(this->m_roots)
+          .subspan(this->m_offsets[i],
+                   this->m_offsets[i + 1] - this->m_offsets[i]);
+    }
+
+    /**
+     * \brief Get the number of roots whose refinement did not converge in the
+     * last batch.
+     * \return The number of failed refinements.
+     */
+    Integer failures() const {
+      return this->m_failures.load();
+    }
+
+  };  // class BatchSolver
+
+}  // namespace Sturm
+
+#endif  // INCLUDE_STURM_BATCHSOLVER_HH
@@ -0,0 +1,574 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef INCLUDE_STURM_DESCARTES_HH
+#define INCLUDE_STURM_DESCARTES_HH
+
+#include "Sturm.hh"
+#include "Sturm/Poly.hh"
+#include "Sturm/Refiner.hh"
+#include "Sturm/Sequence.hh"
+
+namespace Sturm {
+
+  /**
+   * \brief Descartes root isolation class.
+   *
+   * This class isolates the real roots of a polynomial \f$ p(x) \f$ with the
+   * Vincent-Collins-Akritas bisection. The roots in \f$ (a, b) \f$ are the
+   * roots in \f$ (0, 1) \f$ of \f$ q(x) = p(a + (b - a) x) \f$, whose number
+   * is bounded by the sign variations of the coefficients of \f$ (x + 1)^n
+   * q(1/(x + 1)) \f$ (Descartes' rule of signs). The bound is exact when it is
+   * zero or one, otherwise the interval is bisected. Unlike the Sturm
+   * sequence, nothing but the square-free part of \f$ p(x) \f$ is built, and
+   * the test of each interval costs two Taylor shifts, the second of which
+   * stops as soon as two sign variations are found.
+   *
+   * In floating point, \f$ q(x) \f$ is computed from \f$ p(x) \f$ for each
+   * interval rather than from the one of the parent interval as in the exact
+   * algorithm. The cost is the same, one Taylor shift, but the rounding errors
+   * do not pile up along the bisection and stay at the level of the Horner
+   * evaluation of \f$ p(x) \f$ at the interval bounds, which is what the
+   * Sturm sequence relies on. For the same reason, the intervals are split at
+   * zero and at \f$ \pm 1 \f$, and the roots \f$ |x| > 1 \f$ are isolated as
+   * the roots \f$ |y| < 1 \f$ of the reversed polynomial \f$ y^n p(1/y) \f$,
+   * so that the scalings never exceed one and the coefficients of \f$ q(x)
+   * \f$ keep the dynamic range of the ones of \f$ p(x) \f$. The Taylor shifts
+   * may still grow them by \f$ 2^n \f$, which bounds the degree to about 1000
+   * in double precision and to about 120 in single precision.
+   *
+   * The interface mirrors the one of \c Sequence, so that the two engines can
+   * be swapped.
+   * \tparam Real Scalar number type.
+   * \tparam MaxDegree Maximum degree of the polynomial (\c Eigen::Dynamic for
+   * no limit).
+   */
+  template <typename Real, Integer MaxDegree = Eigen::Dynamic>
+  class Descartes {
+   public:
+    constexpr static const Integer MAX_INTERVALS{
+      Sequence<Real, MaxDegree>::MAX_INTERVALS}; /**< Maximum number of
+                                                    intervals. */
+    using Vector =
+        typename Sequence<Real, MaxDegree>::Vector; /**< Vector of real
+                                                       numbers. */
+    using Interval = typename Sequence<Real, MaxDegree>::Interval; /**<
+                                                      Interval structure. */
+
+   private:
+    using Node = struct Node {
+      Real a;         /**< Lower bound of the interval. */
+      Real b;         /**< Upper bound of the interval. */
+      bool reversed;  /**< True if the interval is on the reversed polynomial. */
+      bool a_on_root; /**< True if the lower bound is a root. */
+      bool b_on_root; /**< True if the upper bound is a root. */
+    }; /**< Interval of the bisection. */
+
+    Poly<Real, MaxDegree> m_poly; /**< Square-free part of the polynomial. */
+    Poly<Real, MaxDegree> m_reversed; /**< Reversed square-free part. */
+    Poly<Real, MaxDegree> m_derivative; /**< Derivative of the polynomial. */
+    Poly<Real, MaxDegree> m_gcd;  /**< GCD of the polynomial and derivative. */
+    Poly<Real, MaxDegree> m_q;    /**< Polynomial on the current interval. */
+    Poly<Real, MaxDegree> m_test; /**< Polynomial of the Descartes test. */
+    DivideWorkspace<Real, MaxDegree>
+        m_workspace; /**< Workspace for the divisions. */
+    std::vector<Node> m_stack; /**< Bisection stack (kept across calls). */
+    Container<Interval, MAX_INTERVALS>
+        m_intervals; /**< Computed intervals. */
+    Real m_a{0.0}; /**< Lower bound of the interval containing the roots. */
+    Real m_b{0.0}; /**< Upper bound of the interval containing the roots. */
+
+    /**
+     * \brief Divide \f$ q(x) \f$ by \f$ x - t \f$, with \f$ t = 0 \f$ or
+     * \f$ t = 1 \f$, dropping the remainder.
+     *
+     * Used when an endpoint of the interval is a root, whose rounding errors
+     * in \f$ q(x) \f$ would otherwise be counted as a root inside.
+     * \param[in,out] q Polynomial.
+     * \param[in] t Root, either zero or one.
+     */
+    void deflate(Poly<Real, MaxDegree> &q, Real t) {
+      Integer n{q.order() - 1};
+      Poly<Real, MaxDegree> &r{this->m_test};
+      r.set_order(n);
+      Real b{0.0};
+      for (Integer k{n}; k > 0; --k) {
+        b                 = q.coeff(k) + t * b;
+        r.coeffRef(k - 1) = b;
+      }
+      q = r;
+    }
+
+    /**
+     * \brief Compute \f$ q(x) = p(a + (b - a) x) \f$, normalized.
+     *
+     * See \c Poly::map_interval(...). The bounds that are roots of \f$ p(x) \f$
+     * are divided out.
+     * \param[in] p Polynomial.
+     * \param[in] a Lower bound of the interval.
+     * \param[in] b Upper bound of the interval.
+     * \param[in] a_on_root True if the lower bound is a root.
+     * \param[in] b_on_root True if the upper bound is a root.
+     */
+    void transform(const Poly<Real, MaxDegree> &p,
+                   Real a,
+                   Real b,
+                   bool a_on_root,
+                   bool b_on_root) {
+      Poly<Real, MaxDegree> &q{this->m_q};
+      p.map_interval(a, b, q);
+      if (a_on_root) {
+        this->deflate(q, 0);
+      }
+      if (b_on_root) {
+        this->deflate(q, 1);
+      }
+      q.normalize();
+    }
+
+    /**
+     * \brief Bound the number of roots of \f$ q(x) \f$ in \f$ (0, 1) \f$.
+     *
+     * The coefficients of \f$ (x + 1)^n q(1/(x + 1)) \f$ are obtained by a
+     * Taylor shift of the reversed polynomial. After the \f$ i \f$-th step of
+     * the shift the first \f$ i + 1 \f$ coefficients are final, so the shift
+     * stops as soon as they show two sign variations.
+     * \param[in] q Polynomial.
+     * \return The number of sign variations, clamped to two.
+     */
+    Integer descartes(const Poly<Real, MaxDegree> &q) {
+      Integer n{q.order() - 1};
+      // No sign variations in q(x) means no positive roots at all
+      if (q.sign_variations() == 0) {
+        return 0;
+      }
+      Poly<Real, MaxDegree> &r{this->m_test};
+      r.set_order(n + 1);
+      for (Integer i{0}; i <= n; ++i) {
+        r.coeffRef(i) = q.coeff(n - i);
+      }
+      Integer sign_var{0}, last_sign{0};
+      for (Integer i{0}; i <= n; ++i) {
+        for (Integer j{n - 1}; j >= i; --j) {
+          r.coeffRef(j) += r.coeff(j + 1);
+        }
+        Real v{r.coeff(i)};
+        Integer v_sign{v > 0 ? 1 : (v < 0 ? -1 : 0)};
+        if (v_sign != 0) {
+          if (v_sign == -last_sign && ++sign_var > 1) {
+            return sign_var;
+          }
+          last_sign = v_sign;
+        }
+      }
+      return sign_var;
+    }
+
+    /**
+     * \brief Check if the sign of a polynomial at a point is lost in the
+     * rounding errors.
+     *
+     * The value is compared with the running error bound of Horner's scheme
+     * (see Higham, "Accuracy and Stability of Numerical Algorithms", 2002,
+     * Sec. 5.1), as in \c Sequence::certified_sign_variations(...). An exact
+     * zero is not uncertain.
+     * \param[in] q Polynomial.
+     * \param[in] x Evaluation point.
+     * \return True if the value is nonzero and within its error bound.
+     */
+    static bool uncertain(const Poly<Real, MaxDegree> &q, Real x) {
+      Real v{q.coeff(q.order() - 1)}, mu{std::abs(v) / 2};
+      for (Integer i{q.order() - 2}; i >= 0; --i) {
+        v  = v * x + q.coeff(i);
+        mu = mu * std::abs(x) + std::abs(v);
+      }
+      return v != 0 && std::abs(v) <= std::numeric_limits<Real>::epsilon() *
+                                           (2 * mu - std::abs(v));
+    }
+
+    /**
+     * \brief Choose a splitting point where the sign of a polynomial is known.
+     *
+     * A root within the rounding errors of a splitting point could be counted
+     * on neither side of it, so the nearby points \f$ x \pm h \f$ and \f$ x
+     * \pm 2h \f$ are tried in turn if the sign at \f$ x \f$ is uncertain.
+     * \param[in] q Polynomial.
+     * \param[in] x Preferred splitting point.
+     * \param[in] h Step to the nearby points.
+     * \return The first point with a known sign, or \f$ x \f$ if none.
+     */
+    static Real split(const Poly<Real, MaxDegree> &q, Real x, Real h) {
+      for (Real t : {0.0, -1.0, 1.0, -2.0, 2.0}) {
+        if (!uncertain(q, x + t * h)) {
+          return x + t * h;
+        }
+      }
+      return x;
+    }
+
+    /**
+     * \brief Store a root lying on a point.
+     * \param[in] x Root.
+     */
+    void emit_point(Real x) {
+      this->m_intervals.push_back({x, x, 0, 0, true, true});
+    }
+
+    /**
+     * \brief Store an interval of the bisection containing a single root.
+     * \param[in] I Interval, mapped back through \f$ x = 1/y \f$ if it is on
+     * the reversed polynomial.
+     */
+    void emit_interval(const Node &I) {
+      if (I.reversed) {
+        this->m_intervals.push_back({1 / I.b, 1 / I.a, 1, 0, false, false});
+      } else {
+        this->m_intervals.push_back({I.a, I.b, 1, 0, false, false});
+      }
+    }
+
+    /**
+     * \brief Sort the computed intervals, see \c Sequence.
+     */
+    void sort_intervals() {
+      std::sort(this->m_intervals.begin(),
+                this->m_intervals.end(),
+                [](const Interval &I_a, const Interval &I_b) {
+                  return std::tie(I_a.a, I_a.b) < std::tie(I_b.a, I_b.b);
+                });
+    }
+
+    /**
+     * \brief Compute the root in an interval after the separation.
+     * \param[in] solve_function Root solver, see \c refine_roots(...).
+     * \param[in] I Interval containing a single root.
+     * \param[out] r Root.
+     * \return True if the root solver converged.
+     */
+    template <typename SolveFunction>
+    bool refine_root(SolveFunction &solve_function,
+                     const Interval &I,
+                     Real &r) const {
+      if (I.a_on_root) {
+        r = I.a;
+        return true;
+      } else if (I.b_on_root) {
+        r = I.b;
+        return true;
+      } else {
+        return Sturm::refine_root(solve_function, I.a, I.b, this->m_poly, r);
+      }
+    }
+
+   public:
+    /**
+     * \brief Class constructor for the Descartes root isolation.
+     */
+    Descartes() {}
+
+    /**
+     * \brief Class constructor for the Descartes root isolation given a
+     * polynomial.
+     * \param[in] p Polynomial.
+     */
+    Descartes(const Poly<Real, MaxDegree> &p) {
+      this->build(p);
+    }
+
+    /**
+     * \brief Get the lower bound of the interval containing the roots.
+     * \return The lower bound of the interval containing the roots.
+     */
+    Real a() const {
+      return this->m_a;
+    }
+
+    /**
+     * \brief Get the upper bound of the interval containing the roots.
+     * \return The upper bound of the interval containing the roots.
+     */
+    Real b() const {
+      return this->m_b;
+    }
+
+    /**
+     * \brief Given the polynomial \f$ p(x) \f$ compute its square-free part.
+     *
+     * The square-free part is the quotient of \f$ p(x) \f$ by the greatest
+     * common divisor of \f$ p(x) \f$ and \f$ p'(x) \f$, normalized by a power
+     * of two, so that the exact roots of \f$ p(x) \f$ stay exact.
+     * \param[in] p Polynomial.
+     */
+    void build(const Poly<Real, MaxDegree> &p) {
+      this->m_intervals.clear();
+      this->m_poly = p;
+      this->m_poly.adjust_degree();
+      if (this->m_poly.order() > 2) {
+        this->m_poly.derivative(this->m_derivative);
+        this->m_derivative.adjust_degree();
+        GCD(this->m_poly, this->m_derivative, this->m_gcd, this->m_workspace);
+        if (this->m_gcd.order() > 1) {
+          // A common divisor found in floating point is only kept if it
+          // divides the polynomial, or the square-free part would miss roots
+          this->m_workspace.load(this->m_poly, this->m_gcd);
+          this->m_workspace.divide();
+          this->m_workspace.remainder(this->m_test);
+          Real tolerance{std::sqrt(Poly<Real, MaxDegree>::EPSILON) *
+                         this->m_poly.cwiseAbs().maxCoeff()};
+          if (this->m_test.size() == 0 ||
+              this->m_test.cwiseAbs().maxCoeff() <= tolerance) {
+            this->m_workspace.quotient(this->m_poly);
+          }
+        }
+      }
+      this->m_poly.dilate(1);
+      Integer n{this->m_poly.order()};
+      this->m_reversed.set_order(n);
+      for (Integer i{0}; i < n; ++i) {
+        this->m_reversed.coeffRef(i) = this->m_poly.coeff(n - 1 - i);
+      }
+    }
+
+    /**
+     * \brief Get the square-free part of the polynomial.
+     * \return The square-free part of the polynomial.
+     */
+    const Poly<Real, MaxDegree> &polynomial() const {
+      return this->m_poly;
+    }
+
+    /**
+     * \brief Compute the subintervals containing a single root.
+     *
+     * Given an interval \f$ [a, b] \f$ compute the subintervals containing a
+     * single root.
+     * \return The numbers of intervals (roots) found.
+     */
+    Integer separate_roots(Real a_in, Real b_in) {
+      this->m_intervals.clear();
+      this->m_a = a_in;
+      this->m_b = b_in;
+      const Poly<Real, MaxDegree> &p{this->m_poly};
+      if (p.order() < 2 || !(a_in <= b_in)) {
+        return 0;
+      }
+      // The splitting points near -1, 0 and 1, and the ones of them and of the
+      // bounds that are roots
+      Real s_m{split(p, -1.0, 0.125)};
+      Real s_0{split(p, 0.0, 0.125)};
+      Real s_p{split(p, 1.0, 0.125)};
+      if (p.evaluate(a_in) == 0) {
+        this->emit_point(a_in);
+      }
+      for (Real x : {s_m, s_0, s_p}) {
+        if (a_in < x && x < b_in && p.evaluate(x) == 0) {
+          this->emit_point(x);
+        }
+      }
+      if (b_in != a_in && p.evaluate(b_in) == 0) {
+        this->emit_point(b_in);
+      }
+
+      // Bisection, with the intervals on a stack. The roots on the bounds are
+      // flagged from the values of p(x), since the reversed polynomial may not
+      // vanish at the reciprocal of a root in floating point
+      auto on_root = [&p](Real x) { return p.evaluate(x) == 0; };
+      std::vector<Node> &stack{this->m_stack};
+      stack.clear();
+      if (b_in > s_p) {
+        Real a{std::max(a_in, s_p)};
+        stack.push_back({1 / b_in, 1 / a, true, on_root(b_in), on_root(a)});
+      }
+      if (b_in > s_0 && a_in < s_p) {
+        Real a{std::max(a_in, s_0)}, b{std::min(b_in, s_p)};
+        stack.push_back({a, b, false, on_root(a), on_root(b)});
+      }
+      if (a_in < s_0 && b_in > s_m) {
+        Real a{std::max(a_in, s_m)}, b{std::min(b_in, s_0)};
+        stack.push_back({a, b, false, on_root(a), on_root(b)});
+      }
+      if (a_in < s_m) {
+        Real b{std::min(b_in, s_m)};
+        stack.push_back({1 / b, 1 / a_in, true, on_root(b), on_root(a_in)});
+      }
+      while (!stack.empty()) {
+        Node I{stack.back()};
+        stack.pop_back();
+        const Poly<Real, MaxDegree> &q{I.reversed ? this->m_reversed : p};
+        Real a{I.a}, b{I.b};
+        Real c{split(q, (a + b) / 2, (b - a) / 8)};
+        Real q_a{q.evaluate(a)}, q_b{q.evaluate(b)};
+        bool on_root{I.a_on_root || I.b_on_root};
+        this->transform(q, a, b, I.a_on_root, I.b_on_root);
+        Integer sign_var{this->descartes(this->m_q)};
+        // The sign variations are as many as the roots up to an even number,
+        // so a parity that does not match the signs at the bounds is due to
+        // the rounding errors, and the interval is bisected further. The roots
+        // on the bounds are divided out of q(x) by a factor of constant sign
+        // in (0, 1), so that its signs at 0 and 1 are then the ones just
+        // inside the bounds, up to the same sign
+        if (on_root) {
+          q_a = this->m_q.coeff(0);
+          q_b = this->m_q.evaluate(1);
+        }
+        bool sign_change{(q_a > 0 && q_b < 0) || (q_a < 0 && q_b > 0)};
+        bool consistent{(sign_var == 1) == sign_change};
+        if (sign_var == 0 && consistent) {
+          continue;
+        }
+        // A bound on a root would stop the refinement there, so such
+        // intervals are bisected until the root inside is away from it
+        if (sign_var == 1 && consistent && !on_root) {
+          this->emit_interval(I);
+          continue;
+        }
+        if (!(c > a && c < b) ||
+            b - a <= static_cast<Real>(10.0) *
+                         std::numeric_limits<Real>::epsilon() *
+                         std::max({Real(1.0), std::abs(a), std::abs(b)})) {
+          // Cluster that cannot be separated, taken as a single root
+          this->emit_point(I.reversed ? 1 / c : c);
+          continue;
+        }
+        bool c_on_root{q.evaluate(c) == 0};
+        if (c_on_root) {
+          this->emit_point(I.reversed ? 1 / c : c);
+        }
+        stack.push_back({c, b, I.reversed, c_on_root, I.b_on_root});
+        stack.push_back({a, c, I.reversed, I.a_on_root, c_on_root});
+      }
+      this->sort_intervals();
+      return static_cast<Integer>(this->m_intervals.size());
+    }
+
+    /**
+     * \brief Compute all the subintervals containing a single root.
+     *
+     * Compute an interval \f$ [a, b] \f$ that contains all the real roots and
+     * compute the subintervals containing a single root.
+     * \return The numbers of intervals (roots) found.
+     */
+    Integer separate_roots() {
+      if (this->m_poly.order() < 2) {
+        this->m_intervals.clear();
+        return 0;
+      }
+      Real a, b;
+      this->m_poly.root_bounds(a, b);
+      return this->separate_roots(a, b);
+    }
+
+    /**
+     * \brief Get the number of roots found.
+     * \return The number of roots found.
+     */
+    Integer roots_number() const {
+      return static_cast<Integer>(this->m_intervals.size());
+    }
+
+    /**
+     * Get the \f$ i \f$-th interval containing a single root.
+     * \return The \f$ i \f$-th interval containing a single root.
+     */
+    const Interval &interval(Integer i) const {
+      return this->m_intervals[i];
+    }
+
+    /**
+     * \brief Compute the roots in the intervals after the separation.
+     *
+     * Same as \c Sequence::refine_roots(solve_function, verbose), on the
+     * square-free part of the polynomial.
+     * \param[in] solve_function Root solver.
+     * \param[in] verbose True if the function should print warnings.
+     * \return A vector with the computed roots.
+     * \tparam SolveFunction Refiner or lambda function, see \c Sequence.
+     */
+    template <typename SolveFunction>
+    Vector refine_roots(SolveFunction &&solve_function, bool verbose = false) {
+      Vector roots(this->m_intervals.size());
+      Integer n_roots{static_cast<Integer>(roots.size())};
+      for (Integer n{0}; n < n_roots; ++n) {
+        bool converged{this->refine_root(
+            solve_function, this->m_intervals[n], roots.coeffRef(n))};
+        STURM_ASSERT_WARNING(
+            converged || !verbose,
+            "Sturm::Descartes::refine_roots(...): failed at interval n = "
+                << n + 1);
+      }
+      return roots;
+    }
+
+    /**
+     * \brief Compute the roots in the intervals after the separation in
+     * parallel.
+     *
+     * Same as \c Sequence::refine_roots(solve_function, pool, verbose), on
+     * the square-free part of the polynomial.
+     * \param[in] solve_function Root solver.
+     * \param[in] pool Thread pool.
+     * \param[in] verbose True if the function should print warnings.
+     * \return A vector with the computed roots.
+     * \tparam SolveFunction Refiner or lambda function, see \c Sequence.
+     */
+    template <typename SolveFunction>
+    Vector refine_roots(SolveFunction &&solve_function,
+                        ThreadPool &pool,
+                        bool verbose = false) {
+      Vector roots(this->m_intervals.size());
+      pool.parallel_for(static_cast<Integer>(roots.size()), [&](Integer n) {
+        bool converged{this->refine_root(
+            solve_function, this->m_intervals[n], roots.coeffRef(n))};
+        STURM_ASSERT_WARNING(
+            converged || !verbose,
+            "Sturm::Descartes::refine_roots(...): failed at interval n = "
+                << n + 1);
+      });
+      return roots;
+    }
+
+    /**
+     * \brief Shrink the intervals after the separation to certified brackets.
+     *
+     * Same as \c Sequence::refine_intervals(qir, verbose), on the square-free
+     * part of the polynomial, which changes sign in every interval.
+     * \param[in] qir Quadratic interval refiner.
+     * \param[in] verbose True if the function should print warnings.
+     * \return True if all the intervals are within the tolerance.
+     */
+    bool refine_intervals(const QIR<Real> &qir = QIR<Real>(),
+                          bool verbose         = false) {
+      bool converged_all{true};
+      Integer n_intervals{static_cast<Integer>(this->m_intervals.size())};
+      for (Integer n{0}; n < n_intervals; ++n) {
+        Interval &I{this->m_intervals[n]};
+        if (I.a_on_root || I.b_on_root) {
+          continue;
+        }
+        bool converged{qir.bracket(I.a, I.b, this->m_poly)};
+        if (I.a == I.b) {
+          I.a_on_root = I.b_on_root = true;
+        }
+        STURM_ASSERT_WARNING(
+            converged || !verbose,
+            "Sturm::Descartes::refine_intervals(...): failed at interval n = "
+                << n + 1);
+        converged_all = converged_all && converged;
+      }
+      return converged_all;
+    }
+
+  };  // class Descartes
+
+}  // namespace Sturm
+
+#endif  // INCLUDE_STURM_DESCARTES_HH
@@ -0,0 +1,126 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef INCLUDE_STURM_INVERSE_HH
+#define INCLUDE_STURM_INVERSE_HH
+
+#include "Sturm.hh"
+#include "Sturm/Multiply.hh"
+
+namespace Sturm {
+
+  /**
+   * \brief Extend the power series inverse of a coefficient vector.
+   *
+   * Given the first \f$ n_0 \f$ coefficients of \f$ c(x) = 1/b(x) \bmod x^{n_0}
+   * \f$, compute the first \f$ n \f$ ones with the Newton iteration \f$ c
+   * \leftarrow c - c (b c - 1) \f$, which doubles the number of exact
+   * coefficients at each step. The products go through \c multiply(...), so
+   * that the inversion costs a constant number of multiplications of order \f$
+   * n \f$. When \f$ n_0 = 0 \f$ the iteration starts from \f$ c_0 = 1/b_0 \f$.
+   * \param[in] b Coefficients of the series to invert, with \f$ b_0 \neq 0 \f$.
+   * \param[in] n_b Order of the series to invert.
+   * \param[in,out] c Coefficients of the inverse, of order \f$ n \f$.
+   * \param[in] n_0 Number of coefficients of the inverse already computed.
+   * \param[in] n Number of coefficients of the inverse to compute.
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  inline void inverse_series(const Real *b,
+                             Integer n_b,
+                             Real *c,
+                             Integer n_0,
+                             Integer n) {
+    using Array = Eigen::Array<Real, Eigen::Dynamic, 1>;
+    if (n <= n_0) {
+      return;
+    }
+    if (n_0 < 1) {
+      c[0] = Real(1.0) / b[0];
+      n_0  = 1;
+    }
+    Array e, f;
+    for (Integer k{n_0}; k < n;) {
+      Integer k_new{std::min(2 * k, n)};
+
+      // e(x) = b(x) c(x) mod x^k_new, whose first k coefficients are 1, 0, ...
+      Integer n_e{std::min(n_b, k_new)};
+      e.resize(n_e + k - 1);
+      multiply(b, n_e, c, k, e.data());
+
+      // c(x) += -x^k c(x) e_hi(x) mod x^k_new, with e_hi(x) = e(x) / x^k
+      Integer n_hi{std::min(Integer(e.size()), k_new) - k};
+      if (n_hi > 0) {
+        Integer n_f{k_new - k};
+        f.resize(std::min(k, n_f) + n_hi - 1);
+        multiply(c, std::min(k, n_f), e.data() + k, n_hi, f.data());
+        Eigen::Map<Array> c_new(c + k, n_f);
+        c_new.setZero();
+        Integer n_copy{std::min(n_f, Integer(f.size()))};
+        c_new.head(n_copy) = -f.head(n_copy);
+      } else {
+        Eigen::Map<Array>(c + k, k_new - k).setZero();
+      }
+      k = k_new;
+    }
+  }
+
+  /**
+   * \brief Divide two coefficient vectors with a precomputed inverse.
+   *
+   * Compute the quotient \f$ q(x) \f$ and the remainder \f$ r(x) \f$ of \f$
+   * a(x) = b(x) q(x) + r(x) \f$ from the reversed polynomials, as \f$
+   * \mathrm{rev}(q) = \mathrm{rev}(a) \, \mathrm{rev}(b)^{-1} \bmod x^{n_a -
+   * n_b + 1} \f$ and \f$ r = a - b q \bmod x^{n_b - 1} \f$. Both steps are a
+   * single call to \c multiply(...).
+   * \param[in] a Coefficients of the dividend.
+   * \param[in] n_a Order of the dividend, with \f$ n_a \geq n_b \f$.
+   * \param[in] b Coefficients of the divisor.
+   * \param[in] n_b Order of the divisor.
+   * \param[in] inv First \f$ n_a - n_b + 1 \f$ coefficients of the power series
+   * inverse of the reversed divisor.
+   * \param[out] q Coefficients of the quotient, of order \f$ n_a - n_b + 1 \f$.
+   * \param[out] r Coefficients of the remainder, of order \f$ n_b - 1 \f$
+   * (may be the same as \c a).
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  inline void divide_inverse(const Real *a,
+                             Integer n_a,
+                             const Real *b,
+                             Integer n_b,
+                             const Real *inv,
+                             Real *q,
+                             Real *r) {
+    using Array = Eigen::Array<Real, Eigen::Dynamic, 1>;
+    Integer n_q{n_a - n_b + 1};
+
+    // rev(q) = rev(a) * inv mod x^n_q
+    Array a_rev(Eigen::Map<const Array>(a + n_a - n_q, n_q).reverse());
+    Array t(2 * n_q - 1);
+    multiply(a_rev.data(), n_q, inv, n_q, t.data());
+    Eigen::Map<Array>(q, n_q) = t.head(n_q).reverse();
+
+    // r = a - b * q mod x^(n_b - 1)
+    Integer n_r{n_b - 1};
+    if (n_r > 0) {
+      Integer n_q_r{std::min(n_q, n_r)};
+      t.resize(n_r + n_q_r - 1);
+      multiply(b, n_r, q, n_q_r, t.data());
+      Eigen::Map<Array>(r, n_r) =
+          Eigen::Map<const Array>(a, n_r) - t.head(n_r);
+    }
+  }
+
+}  // namespace Sturm
+
+#endif  // INCLUDE_STURM_INVERSE_HH
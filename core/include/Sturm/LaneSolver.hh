@@ -0,0 +1,637 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef INCLUDE_STURM_LANESOLVER_HH
+#define INCLUDE_STURM_LANESOLVER_HH
+
+#include "Sturm.hh"
+#include "Sturm/Poly.hh"
+#include "Sturm/Sequence.hh"
+
+namespace Sturm {
+
+  /**
+   * \brief Lane-parallel root solver class for polynomials of the same degree.
+   *
+   * This class isolates and refines the real roots of many polynomials of the
+   * same degree, in a structure-of-arrays layout where each SIMD lane holds a
+   * different polynomial. The polynomials are processed in blocks of \c Lanes:
+   *
+   * - the Sturm sequences are built in lockstep, assuming that every remainder
+   *   has degree one less than the divisor (i.e., the sequence is normal, as it
+   *   is for almost all polynomials), so that each division step is the same
+   *   two-term quotient for all the lanes;
+   * - the roots are separated by bisection, where each lane keeps its own
+   *   stack of intervals and one midpoint per lane is evaluated at each round
+   *   by a single lane-parallel Horner pass over the whole sequence, and the
+   *   lanes that run out of intervals are masked;
+   * - the isolating intervals of all the lanes are queued and refined by the
+   *   Illinois method, one root per lane, and a lane is reloaded as soon as
+   *   its root converges, so that the refinement does not depend on how the
+   *   roots are spread among the polynomials.
+   *
+   * The lanes whose sequence is not normal (leading coefficient equal to zero,
+   * remainders at the rounding error level, e.g., because of multiple roots,
+   * or overflow), whose sequence is too inaccurate because of close roots, or
+   * whose counts of roots turn out inconsistent, are handed to the scalar \c
+   * Sequence. The roots are returned in the same compressed sparse row
+   * layout of \c BatchSolver.
+   * \tparam Real Scalar number type.
+   * \tparam Degree Degree of the polynomials.
+   * \tparam Lanes Number of polynomials processed together.
+   */
+  template <typename Real, Integer Degree, Integer Lanes = 8>
+  class LaneSolver {
+    static_assert(Degree >= 1, "Sturm::LaneSolver: degree must be positive.");
+
+   public:
+    constexpr static const Integer ORDER{Degree +
+                                         1}; /**< Polynomial order. */
+    constexpr static const Integer CHAIN_SIZE{
+      ORDER * (ORDER + 1) / 2}; /**< Coefficients of the Sturm sequence. */
+    constexpr static const Real EPSILON{
+      std::numeric_limits<Real>::epsilon()}; /**< Machine epsilon. */
+    constexpr static const Integer MAX_ITERATIONS{
+      200}; /**< Maximum number of refinement iterations. */
+    constexpr static const Real CHAIN_ERROR{
+      1.0e3}; /**< Largest relative error bound of a normal Sturm sequence. */
+    using Lane  = Eigen::Array<Real, Lanes, 1>;    /**< Values of the lanes. */
+    using Count = Eigen::Array<Integer, Lanes, 1>; /**< Counts of the lanes. */
+    using Mask  = Eigen::Array<bool, Lanes, 1>;    /**< Mask of the lanes. */
+    using Matrix =
+        Eigen::Matrix<Real, ORDER, Eigen::Dynamic>; /**< Coefficient matrix. */
+
+   private:
+    using Interval = struct Interval {
+      Real a;     /**< Lower bound of the interval. */
+      Real b;     /**< Upper bound of the interval. */
+      Integer va; /**< Sign variations at the lower bound. */
+      Integer vb; /**< Sign variations at the upper bound. */
+    }; /**< Interval \f$ (a, b] \f$ of the separation. */
+    using Root = struct Root {
+      std::array<Real, ORDER> c; /**< Coefficients of the polynomial. */
+      Real a;                    /**< Lower bound of the bracket. */
+      Real b;                    /**< Upper bound of the bracket. */
+      Integer slot;              /**< Position in the output vector. */
+    }; /**< Root to refine. */
+
+    std::array<Lane, CHAIN_SIZE>
+        m_chain; /**< Sturm sequences, the \f$ j \f$-th coefficient of \f$
+                    p_k(x) \f$ starts at \c offset(k) + j. */
+    std::array<std::array<Interval, Degree>, Lanes>
+        m_stack;                     /**< Intervals to process per lane. */
+    std::array<Integer, Lanes> m_stack_size; /**< Stack sizes per lane. */
+    std::array<std::array<Interval, Degree>, Lanes>
+        m_isolated; /**< Isolating intervals per lane. */
+    std::array<Integer, Lanes>
+        m_isolated_size; /**< Number of isolating intervals per lane. */
+    std::vector<Root> m_pending; /**< Roots waiting to be refined. */
+    std::size_t m_next{0};       /**< Next pending root to refine. */
+    std::array<Lane, ORDER> m_c; /**< Polynomials being refined. */
+    Lane m_A;    /**< Lower bounds of the brackets being refined. */
+    Lane m_B;    /**< Upper bounds of the brackets being refined. */
+    Lane m_FA;   /**< Values at the lower bounds. */
+    Lane m_FB;   /**< Values at the upper bounds. */
+    Lane m_side; /**< Side of the last Illinois update. */
+    std::array<Integer, Lanes> m_slot; /**< Output position of the root
+                                          in each lane (-1 if empty). */
+    std::array<Integer, Lanes> m_iter; /**< Iterations of each lane. */
+    Sequence<Real, Degree> m_sequence; /**< Scalar fallback sequence. */
+    Poly<Real, Degree> m_poly;         /**< Scalar fallback polynomial. */
+    std::vector<Integer> m_offsets; /**< Offsets of the roots of each
+                                       polynomial. */
+    std::vector<Real> m_roots;      /**< Roots of all the polynomials. */
+    Integer m_fallbacks{0}; /**< Polynomials solved by the scalar path. */
+    Integer m_failures{0};  /**< Number of failed refinements. */
+
+    /**
+     * \brief Get the offset of the \f$ k \f$-th polynomial of the sequence.
+     * \param[in] k Index of the polynomial.
+     * \return The offset of its first coefficient.
+     */
+    constexpr static Integer offset(Integer k) {
+      return k * ORDER - k * (k - 1) / 2;
+    }
+
+    /**
+     * \brief Evaluate a polynomial stored in lanes with the Horner scheme.
+     * \param[in] c Coefficients of the polynomial.
+     * \param[in] n Order of the polynomial.
+     * \param[in] x Evaluation points.
+     * \return The values of the polynomial.
+     */
+    static Lane horner(const Lane *c, Integer n, const Lane &x) {
+      Lane v{c[n - 1]};
+      for (Integer j{n - 2}; j >= 0; --j) {
+        v = v * x + c[j];
+      }
+      return v;
+    }
+
+    /**
+     * \brief Build the Sturm sequences of the current block.
+     *
+     * Each polynomial is normalized by its maximum absolute coefficient, which
+     * is a positive scaling and does not change the sign variations. Close
+     * roots make each remainder a small difference of large terms, which
+     * magnifies the errors of the previous polynomials of the sequence, until
+     * the counts are noise. A first-order bound of the relative error of each
+     * remainder is carried along the sequence, and a lane whose bound exceeds
+     * \c CHAIN_ERROR is handed to the scalar sequence. The bound assumes that
+     * all the errors add up, which they hardly do, hence the large threshold.
+     * \return The mask of the lanes whose sequence is normal.
+     */
+    Mask build() {
+      Lane scale{Lane::Zero()};
+      for (Integer j{0}; j < ORDER; ++j) {
+        scale = scale.max(this->m_chain[j].abs());
+      }
+      Mask normal{this->m_chain[Degree] != 0};
+      for (Integer j{0}; j < ORDER; ++j) {
+        this->m_chain[j] /= scale;
+      }
+      // p_1(x) = p_0'(x)
+      Lane *p_1{&this->m_chain[offset(1)]};
+      for (Integer j{0}; j < Degree; ++j) {
+        p_1[j] = static_cast<Real>(j + 1) * this->m_chain[j + 1];
+      }
+      // p_{k+1}(x) = -rem(p_{k-1}(x), p_k(x)), with deg p_k = Degree - k
+      Lane e_a{Lane::Constant(EPSILON)}, e_b{Lane::Constant(ORDER * EPSILON)};
+      for (Integer k{1}; k < Degree; ++k) {
+        const Lane *a{&this->m_chain[offset(k - 1)]};
+        const Lane *b{&this->m_chain[offset(k)]};
+        Lane *r{&this->m_chain[offset(k + 1)]};
+        Integer d{Degree - k};
+        normal = normal && b[d] != 0;
+        Lane q_1{a[d + 1] / b[d]};
+        Lane q_0{(a[d] - q_1 * b[d - 1]) / b[d]};
+        scale.setZero();
+        for (Integer j{0}; j < d; ++j) {
+          r[j] = q_0 * b[j] - a[j];
+          if (j > 0) {
+            r[j] += q_1 * b[j - 1];
+          }
+          scale = scale.max(r[j].abs());
+        }
+        // A remainder lost in the rounding errors of the division means that
+        // the polynomials have a common factor (or nearly so)
+        Lane q_abs{q_1.abs() + q_0.abs()};
+        normal = normal && scale > 10 * ORDER * EPSILON * (1 + q_abs) &&
+                 scale < std::numeric_limits<Real>::infinity();
+        // The errors of the dividend and the divisor are carried over to the
+        // remainder and magnified by its cancellation as well
+        Lane e_r{(e_a + q_abs * e_b + ORDER * EPSILON * (1 + q_abs)) / scale};
+        normal = normal && e_r < CHAIN_ERROR;
+        e_a = e_b;
+        e_b = e_r;
+        for (Integer j{0}; j < d; ++j) {
+          r[j] /= scale;
+        }
+      }
+      return normal;
+    }
+
+    /**
+     * \brief Compute the sign variations of the Sturm sequences of the current
+     * block.
+     * \param[in] x Evaluation points, one per lane.
+     * \return The number of sign variations per lane.
+     */
+    Count sign_variations(const Lane &x) const {
+      Lane var{Lane::Zero()}, last{Lane::Zero()}, s, t;
+      for (Integer k{0}; k < ORDER; ++k) {
+        Lane v{horner(&this->m_chain[offset(k)], ORDER - k, x)};
+        for (Integer l{0}; l < Lanes; ++l) {
+          s[l] = v[l] > 0 ? Real(1.0) : Real(0.0);
+          t[l] = v[l] < 0 ? Real(1.0) : Real(0.0);
+        }
+        s -= t;
+        // Signs are -1, 0 or 1, and the zeros keep the last nonzero sign
+        var += (-s * last).max(0);
+        last = s + (1 - s.abs()) * last;
+      }
+      return var.template cast<Integer>();
+    }
+
+    /**
+     * \brief Queue a root of a polynomial for the refinement.
+     * \param[in] c Coefficients of the polynomial.
+     * \param[in] a Lower bound of the bracket.
+     * \param[in] b Upper bound of the bracket.
+     */
+    template <typename Coeffs>
+    void queue(Coeffs &&c, Real a, Real b) {
+      Root &R{this->m_pending.emplace_back()};
+      for (Integer j{0}; j < ORDER; ++j) {
+        R.c[j] = c(j);
+      }
+      R.a    = a;
+      R.b    = b;
+      R.slot = static_cast<Integer>(this->m_roots.size());
+      this->m_roots.push_back(a);
+      if (this->m_pending.size() >= 4 * Lanes) {
+        this->refine(false);
+      }
+    }
+
+    /**
+     * \brief Separate the roots of the current block in lockstep.
+     *
+     * The rounding errors of the chain may give sign variations that are not
+     * monotone, and so inconsistent counts of roots, which could also overflow
+     * the interval stacks. Such a lane is dropped from the separation and
+     * flagged for the scalar sequence.
+     * \param[in] active Mask of the lanes to process.
+     * \return The mask of the lanes whose separation is consistent.
+     */
+    Mask separate(const Mask &active) {
+      // Cauchy's bounds of the normalized polynomials
+      Lane bound{Lane::Ones() / this->m_chain[Degree].abs() + 1};
+      Count va{this->sign_variations(-bound)};
+      Count vb{this->sign_variations(bound)};
+      Mask consistent{Mask::Constant(true)};
+      for (Integer l{0}; l < Lanes; ++l) {
+        this->m_stack_size[l]    = 0;
+        this->m_isolated_size[l] = 0;
+        consistent[l]            = va[l] >= vb[l];
+        if (active[l] && va[l] > vb[l]) {
+          this->m_stack[l][0]   = {-bound[l], bound[l], va[l], vb[l]};
+          this->m_stack_size[l] = 1;
+        }
+      }
+      std::array<std::array<Interval, Degree>, Lanes> &isolated{
+        this->m_isolated};
+      std::array<Integer, Lanes> &n_isolated{this->m_isolated_size};
+      Lane x{Lane::Zero()};
+      while (true) {
+        // Move the isolating intervals out and pick a midpoint per lane
+        bool any{false};
+        for (Integer l{0}; l < Lanes; ++l) {
+          Integer &n{this->m_stack_size[l]};
+          while (n > 0 && this->m_stack[l][n - 1].va -
+                                  this->m_stack[l][n - 1].vb ==
+                              1) {
+            isolated[l][n_isolated[l]++] = this->m_stack[l][--n];
+          }
+          if (n > 0) {
+            const Interval &I{this->m_stack[l][n - 1]};
+            x[l] = (I.a + I.b) / 2;
+            any  = true;
+          }
+        }
+        if (!any) {
+          break;
+        }
+        Count vc{this->sign_variations(x)};
+        for (Integer l{0}; l < Lanes; ++l) {
+          Integer &n{this->m_stack_size[l]};
+          if (n == 0) {
+            continue;
+          }
+          Interval I{this->m_stack[l][--n]};
+          Real c{x[l]};
+          Integer n_halves{(vc[l] > I.vb ? 1 : 0) + (I.va > vc[l] ? 1 : 0)};
+          if (vc[l] < I.vb || vc[l] > I.va || n + n_halves > Degree ||
+              n_isolated[l] >= Degree) {
+            consistent[l] = false;
+            n             = 0;
+            continue;
+          }
+          if (!(c > I.a && c < I.b) ||
+              I.b - I.a <= 10 * EPSILON *
+                               std::max({Real(1.0), std::abs(I.a),
+                                         std::abs(I.b)})) {
+            // Cluster that cannot be separated, taken as the midpoint repeated
+            // once per real root
+            isolated[l][n_isolated[l]++] = {c, c, I.va, I.vb};
+            continue;
+          }
+          // Push the right half first, so that the roots come out sorted
+          if (vc[l] > I.vb) {
+            this->m_stack[l][n++] = {c, I.b, vc[l], I.vb};
+          }
+          if (I.va > vc[l]) {
+            this->m_stack[l][n++] = {I.a, c, I.va, vc[l]};
+          }
+        }
+      }
+      return consistent;
+    }
+
+    /**
+     * \brief Solve a polynomial whose Sturm sequence is not normal with the
+     * scalar sequence.
+     * \param[in] i Index of the polynomial.
+     */
+    void fallback(Integer i) {
+      ++this->m_fallbacks;
+      this->m_poly.adjust_degree();
+      Integer n_roots{0};
+      if (this->m_poly.degree() > 0) {
+        this->m_sequence.build(this->m_poly);
+        Integer n_intervals{this->m_sequence.separate_roots()};
+        // Refine on the square-free part, which changes sign at every root
+        const Poly<Real, Degree> &p{this->m_sequence.get(0)};
+        for (Integer j{0}; j < n_intervals; ++j) {
+          const typename Sequence<Real, Degree>::Interval &I{
+            this->m_sequence.interval(j)};
+          Real a{I.a_on_root ? I.a : (I.b_on_root ? I.b : I.a)};
+          Real b{I.a_on_root || I.b_on_root ? a : I.b};
+          Integer n_copies{1};
+          // A cluster of roots is reported at the centre of its interval, once
+          // per real root
+          if (I.multiplicity > 1) {
+            a        = (I.a + I.b) / 2.0;
+            b        = a;
+            n_copies = std::abs(I.va - I.vb);
+          }
+          for (Integer n{0}; n < n_copies; ++n) {
+            this->queue(
+                [&p](Integer k) {
+                  return k < p.order() ? p.coeff(k) : Real(0.0);
+                },
+                a,
+                b);
+          }
+          n_roots += n_copies;
+        }
+      }
+      this->m_offsets[i + 1] = n_roots;
+    }
+
+    /**
+     * \brief Load the next pending root into a lane of the refinement.
+     *
+     * A root whose bracket is a single point, or whose upper bound is a zero of
+     * the polynomial, is stored at once. A zero of the polynomial at the lower
+     * bound belongs to the previous interval, and the value there is replaced
+     * by the opposite of the one at the upper bound.
+     * \param[in] l Index of the lane.
+     */
+    void load(Integer l) {
+      this->m_slot[l] = -1;
+      while (this->m_next < this->m_pending.size()) {
+        const Root &R{this->m_pending[this->m_next++]};
+        Real fa{R.c[Degree]}, fb{R.c[Degree]};
+        for (Integer j{Degree - 1}; j >= 0; --j) {
+          fa = fa * R.a + R.c[j];
+          fb = fb * R.b + R.c[j];
+        }
+        if (R.a == R.b || fb == 0) {
+          this->m_roots[R.slot] = R.b;
+          continue;
+        }
+        for (Integer j{0}; j < ORDER; ++j) {
+          this->m_c[j][l] = R.c[j];
+        }
+        this->m_A[l]    = R.a;
+        this->m_B[l]    = R.b;
+        this->m_FA[l]   = fa == 0 ? -fb : fa;
+        this->m_FB[l]   = fb;
+        this->m_side[l] = 0;
+        this->m_iter[l] = 0;
+        this->m_slot[l] = R.slot;
+        return;
+      }
+    }
+
+    /**
+     * \brief Refine the queued roots in lockstep with the Illinois method.
+     *
+     * Each lane refines a different root, and a lane whose root has converged
+     * is loaded with the next pending one, so that the lanes stay busy
+     * regardless of how many steps each root takes. Every fourth step is a
+     * bisection for all the lanes, so that the brackets are guaranteed to
+     * shrink. The lanes are updated with element-wise conditionals that only
+     * choose between values computed for all the lanes, so that the compiler
+     * turns them into blends (Eigen's select is not vectorized).
+     * \param[in] flush If true, refine until all the roots have converged,
+     * otherwise stop as soon as the pending roots have all been loaded.
+     */
+    void refine(bool flush) {
+      Lane &A{this->m_A}, &B{this->m_B}, &FA{this->m_FA}, &FB{this->m_FB};
+      Lane &side{this->m_side};
+      Lane Y, FY, GA, GB, HA, HB, width;
+      Integer iter{0};
+      for (Integer l{0}; l < Lanes; ++l) {
+        if (this->m_slot[l] < 0) {
+          this->load(l);
+        }
+      }
+      while (flush || this->m_next < this->m_pending.size()) {
+        bool any{false};
+        for (Integer l{0}; l < Lanes; ++l) {
+          any |= this->m_slot[l] >= 0;
+        }
+        if (!any) {
+          break;
+        }
+        // Secant point, replaced by the midpoint when out of the bracket
+        bool secant{(++iter & 3) != 0};
+        for (Integer l{0}; l < Lanes; ++l) {
+          Real s{(A[l] * FB[l] - B[l] * FA[l]) / (FB[l] - FA[l])};
+          Real m{(A[l] + B[l]) / 2};
+          Y[l] = secant && std::min(s - A[l], B[l] - s) > 0 ? s : m;
+        }
+        FY = horner(this->m_c.data(), ORDER, Y);
+        GA = FY * FA;
+        GB = FY * FB;
+        HA = FA / 2;
+        HB = FB / 2;
+        // Illinois update, halving the value at the bound retained twice
+        for (Integer l{0}; l < Lanes; ++l) {
+          FA[l] = std::min(GB[l], side[l]) > 0 ? HA[l] : FA[l];
+          FB[l] = std::min(GA[l], -side[l]) > 0 ? HB[l] : FB[l];
+        }
+        // A zero of the polynomial collapses the bracket onto it
+        for (Integer l{0}; l < Lanes; ++l) {
+          A[l]  = GA[l] >= 0 ? Y[l] : A[l];
+          FA[l] = GA[l] >= 0 ? FY[l] : FA[l];
+          B[l]  = GB[l] >= 0 ? Y[l] : B[l];
+          FB[l] = GB[l] >= 0 ? FY[l] : FB[l];
+        }
+        for (Integer l{0}; l < Lanes; ++l) {
+          side[l] = GA[l] > 0 ? Real(-1.0) : side[l];
+          side[l] = GB[l] > 0 ? Real(1.0) : side[l];
+        }
+        width = (B - A) - 4 * EPSILON * A.abs().max(B.abs()).max(1);
+        for (Integer l{0}; l < Lanes; ++l) {
+          if (this->m_slot[l] < 0) {
+            continue;
+          }
+          bool done{width[l] <= 0};
+          if (done || ++this->m_iter[l] >= MAX_ITERATIONS) {
+            this->m_failures += done ? 0 : 1;
+            this->m_roots[this->m_slot[l]] = (A[l] + B[l]) / 2;
+            this->load(l);
+          }
+        }
+      }
+      if (this->m_next == this->m_pending.size()) {
+        this->m_pending.clear();
+        this->m_next = 0;
+      }
+    }
+
+    /**
+     * \brief Solve a batch of polynomials.
+     * \param[in] n_poly Number of polynomials.
+     * \param[in] coeff Function returning the \f$ j \f$-th coefficient of the
+     * \f$ i \f$-th polynomial.
+     * \return The total number of roots found.
+     * \tparam Coeff Callable with the signature `Real(Integer i, Integer j)`.
+     */
+    template <typename Coeff>
+    Integer solve_batch(Integer n_poly, Coeff &&coeff) {
+      this->m_offsets.assign(n_poly + 1, 0);
+      this->m_roots.clear();
+      this->m_pending.clear();
+      this->m_pending.reserve(4 * Lanes);
+      this->m_next = 0;
+      this->m_slot.fill(-1);
+      this->m_fallbacks = 0;
+      this->m_failures  = 0;
+      for (Integer first{0}; first < n_poly; first += Lanes) {
+        // Load the block, padding the last one with copies of its first lane
+        Mask active;
+        for (Integer l{0}; l < Lanes; ++l) {
+          Integer i{first + l < n_poly ? first + l : first};
+          active[l] = first + l < n_poly;
+          for (Integer j{0}; j < ORDER; ++j) {
+            this->m_chain[j][l] = coeff(i, j);
+          }
+        }
+        Mask normal{this->build()};
+        normal = normal && this->separate(active && normal);
+        // Queue the roots lane by lane, so that they are stored in order
+        for (Integer l{0}; l < Lanes && first + l < n_poly; ++l) {
+          if (normal[l]) {
+            Integer n_roots{0};
+            for (Integer k{0}; k < this->m_isolated_size[l]; ++k) {
+              const Interval &I{this->m_isolated[l][k]};
+              for (Integer n{0}; n < I.va - I.vb; ++n) {
+                this->queue(
+                    [this, l](Integer j) { return this->m_chain[j][l]; },
+                    I.a,
+                    I.b);
+              }
+              n_roots += I.va - I.vb;
+            }
+            this->m_offsets[first + l + 1] = n_roots;
+          } else {
+            this->m_poly.set_order(ORDER);
+            for (Integer j{0}; j < ORDER; ++j) {
+              this->m_poly.coeffRef(j) = coeff(first + l, j);
+            }
+            this->fallback(first + l);
+          }
+        }
+      }
+      this->refine(true);
+      // The roots are queued in order, so the counts become the offsets
+      for (Integer i{0}; i < n_poly; ++i) {
+        this->m_offsets[i + 1] += this->m_offsets[i];
+      }
+      return this->m_offsets[n_poly];
+    }
+
+   public:
+    /**
+     * \brief Class constructor for the lane-parallel solver.
+     */
+    LaneSolver() {}
+
+    /**
+     * \brief Isolate and refine the real roots of a batch of polynomials.
+     * \param[in] polys Polynomials, whose order is at most \c ORDER.
+     * \return The total number of roots found.
+     */
+    Integer solve(std::span<const Poly<Real, Degree>> polys) {
+      return this->solve_batch(static_cast<Integer>(polys.size()),
+                               [polys](Integer i, Integer j) {
+                                 const Poly<Real, Degree> &p{polys[i]};
+                                 return j < p.order() ? p.coeff(j) : Real(0.0);
+                               });
+    }
+
+    /**
+     * \brief Isolate and refine the real roots of a batch of polynomials
+     * stored in a coefficient matrix.
+     * \param[in] coeffs Coefficient matrix, whose \f$ (k, i) \f$ entry is the
+     * \f$ k \f$-th coefficient of the \f$ i \f$-th polynomial.
+     * \return The total number of roots found.
+     */
+    Integer solve(const Matrix &coeffs) {
+      return this->solve_batch(
+          static_cast<Integer>(coeffs.cols()),
+          [&coeffs](Integer i, Integer j) { return coeffs(j, i); });
+    }
+
+    /**
+     * \brief Get the number of polynomials of the last batch.
+     * \return The number of polynomials.
+     */
+    Integer size() const {
+      return std::max(static_cast<Integer>(this->m_offsets.size()) - 1,
+                      Integer(0));
+    }
+
+    /**
+     * \brief Get the offsets of the roots of each polynomial.
+     * \return The offsets, of size \c size() + 1.
+     */
+    std::span<const Integer> offsets() const {
+      return this->m_offsets;
+    }
+
+    /**
+     * \brief Get the roots of all the polynomials.
+     * \return The flat vector of the roots.
+     */
+    std::span<const Real> roots() const {
+      return this->m_roots;
+    }
+
+    /**
+     * \brief Get the roots of the \f$ i \f$-th polynomial.
+     * \param[in] i Index of the polynomial.
+     * \return The roots of the \f$ i \f$-th polynomial, in ascending order.
+     */
+    std::span<const Real> roots(Integer i) const {
+      return std::span<const Real>(this->m_roots)
+          .subspan(this->m_offsets[i],
+                   this->m_offsets[i + 1] - this->m_offsets[i]);
+    }
+
+    /**
+     * \brief Get the number of polynomials of the last batch that were solved
+     * by the scalar sequence.
+     * \return The number of fallbacks.
+     */
+    Integer fallbacks() const {
+      return this->m_fallbacks;
+    }
+
+    /**
+     * \brief Get the number of roots whose refinement did not converge in the
+     * last batch.
+     * \return The number of failed refinements.
+     */
+    Integer failures() const {
+      return this->m_failures;
+    }
+
+  };  // class LaneSolver
+
+}  // namespace Sturm
+
+#endif  // INCLUDE_STURM_LANESOLVER_HH
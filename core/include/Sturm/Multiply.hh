@@ -0,0 +1,271 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef INCLUDE_STURM_MULTIPLY_HH
+#define INCLUDE_STURM_MULTIPLY_HH
+
+#include "Sturm.hh"
+
+namespace Sturm {
+
+  /**
+   * \brief Multiply two coefficient vectors with the schoolbook algorithm.
+   *
+   * Compute the coefficients \f$ c_k = \sum_{i+j=k} a_i b_j \f$ of the product
+   * with \f$ \mathcal{O}(n_a n_b) \f$ operations, as a sequence of vectorized
+   * updates along the longer operand.
+   * \param[in] a Coefficients of the first polynomial.
+   * \param[in] n_a Order of the first polynomial.
+   * \param[in] b Coefficients of the second polynomial.
+   * \param[in] n_b Order of the second polynomial.
+   * \param[out] c Coefficients of the product, of order \f$ n_a + n_b - 1 \f$.
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  inline void multiply_schoolbook(const Real *a,
+                                  Integer n_a,
+                                  const Real *b,
+                                  Integer n_b,
+                                  Real *c) {
+    using Array = Eigen::Array<Real, Eigen::Dynamic, 1>;
+    if (n_a < n_b) {
+      std::swap(a, b);
+      std::swap(n_a, n_b);
+    }
+    Eigen::Map<const Array> a_map(a, n_a);
+    Eigen::Map<Array> c_map(c, n_a + n_b - 1);
+    c_map.setZero();
+    for (Integer j{0}; j < n_b; ++j) {
+      c_map.segment(j, n_a) += b[j] * a_map;
+    }
+  }
+
+  /**
+   * \brief Multiply two coefficient vectors with the Karatsuba algorithm.
+   *
+   * Split the operands in halves \f$ a(x) = a_0(x) + x^m a_1(x) \f$ and \f$
+   * b(x) = b_0(x) + x^m b_1(x) \f$, and compute the product with the three
+   * half-size products \f$ a_0 b_0 \f$, \f$ a_1 b_1 \f$ and \f$ (a_0 + a_1)
+   * (b_0 + b_1) \f$, for \f$ \mathcal{O}(n^{\log_2 3}) \f$ operations. Very
+   * unbalanced operands are split into chunks of the shorter order first. The
+   * recursion goes through \c multiply(...), so that small subproducts fall
+   * back to the schoolbook algorithm.
+   * \param[in] a Coefficients of the first polynomial.
+   * \param[in] n_a Order of the first polynomial.
+   * \param[in] b Coefficients of the second polynomial.
+   * \param[in] n_b Order of the second polynomial.
+   * \param[out] c Coefficients of the product, of order \f$ n_a + n_b - 1 \f$.
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  inline void multiply_karatsuba(const Real *a,
+                                 Integer n_a,
+                                 const Real *b,
+                                 Integer n_b,
+                                 Real *c);
+
+  /**
+   * \brief Multiply two coefficient vectors with a real FFT convolution.
+   *
+   * The operands are scaled to unit maximum norm and packed into the real and
+   * imaginary parts of a single complex sequence \f$ z = a + \mathrm{i} b \f$.
+   * Since \f$ z^2 = a^2 - b^2 + 2 \mathrm{i} a b \f$, the product is half the
+   * imaginary part of the cyclic self-convolution of \f$ z \f$, which takes
+   * one forward and one inverse radix-2 FFT for \f$ \mathcal{O}(n \log n) \f$
+   * operations. The rounding error grows with \f$ \log n \f$ and is relative
+   * to the largest coefficients of the operands.
+   * \param[in] a Coefficients of the first polynomial.
+   * \param[in] n_a Order of the first polynomial.
+   * \param[in] b Coefficients of the second polynomial.
+   * \param[in] n_b Order of the second polynomial.
+   * \param[out] c Coefficients of the product, of order \f$ n_a + n_b - 1 \f$.
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  inline void multiply_fft(const Real *a,
+                           Integer n_a,
+                           const Real *b,
+                           Integer n_b,
+                           Real *c);
+
+  /**
+   * \brief Multiply two coefficient vectors.
+   *
+   * Select the schoolbook, Karatsuba or FFT algorithm from the order of the
+   * shorter operand, with the crossovers \c STURM_KARATSUBA_THRESHOLD and \c
+   * STURM_FFT_THRESHOLD.
+   * \param[in] a Coefficients of the first polynomial.
+   * \param[in] n_a Order of the first polynomial.
+   * \param[in] b Coefficients of the second polynomial.
+   * \param[in] n_b Order of the second polynomial.
+   * \param[out] c Coefficients of the product, of order \f$ n_a + n_b - 1 \f$.
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  inline void multiply(const Real *a,
+                       Integer n_a,
+                       const Real *b,
+                       Integer n_b,
+                       Real *c) {
+    Integer n_min{std::min(n_a, n_b)};
+    if (n_min < STURM_KARATSUBA_THRESHOLD) {
+      multiply_schoolbook(a, n_a, b, n_b, c);
+    } else if (n_min < STURM_FFT_THRESHOLD) {
+      multiply_karatsuba(a, n_a, b, n_b, c);
+    } else {
+      multiply_fft(a, n_a, b, n_b, c);
+    }
+  }
+
+  template <typename Real>
+  inline void multiply_karatsuba(const Real *a,
+                                 Integer n_a,
+                                 const Real *b,
+                                 Integer n_b,
+                                 Real *c) {
+    using Array = Eigen::Array<Real, Eigen::Dynamic, 1>;
+    if (n_a < n_b) {
+      std::swap(a, b);
+      std::swap(n_a, n_b);
+    }
+    if (n_b < 2) {
+      multiply_schoolbook(a, n_a, b, n_b, c);
+      return;
+    }
+    Eigen::Map<Array> c_map(c, n_a + n_b - 1);
+    Integer m{(n_a + 1) / 2};
+
+    // Unbalanced operands: multiply b(x) by chunks of a(x) of order n_b
+    if (n_b <= m) {
+      Array z(2 * n_b - 1);
+      c_map.setZero();
+      for (Integer i{0}; i < n_a; i += n_b) {
+        Integer n_i{std::min(n_b, n_a - i)};
+        multiply(a + i, n_i, b, n_b, z.data());
+        c_map.segment(i, n_i + n_b - 1) += z.head(n_i + n_b - 1);
+      }
+      return;
+    }
+
+    // Balanced operands: a_0 and b_0 have order m, a_1 and b_1 the rest
+    Eigen::Map<const Array> a_0(a, m), a_1(a + m, n_a - m);
+    Eigen::Map<const Array> b_0(b, m), b_1(b + m, n_b - m);
+    Array a_01(a_0), b_01(b_0);
+    a_01.head(n_a - m) += a_1;
+    b_01.head(n_b - m) += b_1;
+
+    Integer n_z_2{n_a + n_b - 2 * m - 1};
+    Array z_0(2 * m - 1), z_1(2 * m - 1), z_2(n_z_2);
+    multiply(a_0.data(), m, b_0.data(), m, z_0.data());
+    multiply(a_1.data(), n_a - m, b_1.data(), n_b - m, z_2.data());
+    multiply(a_01.data(), m, b_01.data(), m, z_1.data());
+    z_1 -= z_0;
+    z_1.head(n_z_2) -= z_2;
+
+    // c(x) = z_0(x) + x^m z_1(x) + x^(2m) z_2(x)
+    c_map.setZero();
+    c_map.head(2 * m - 1) += z_0;
+    c_map.segment(m, 2 * m - 1) += z_1;
+    c_map.tail(n_z_2) += z_2;
+  }
+
+  template <typename Real>
+  inline void multiply_fft(const Real *a,
+                           Integer n_a,
+                           const Real *b,
+                           Integer n_b,
+                           Real *c) {
+    using Array = Eigen::Array<Real, Eigen::Dynamic, 1>;
+
+    // Transform size, the smallest power of 2 fitting the product
+    Integer n_c{n_a + n_b - 1};
+    Integer n{4};
+    while (n < n_c) {
+      n <<= 1;
+    }
+
+    // Pack the scaled operands as z = a + i b
+    Real scale_a{Eigen::Map<const Array>(a, n_a).abs().maxCoeff()};
+    Real scale_b{Eigen::Map<const Array>(b, n_b).abs().maxCoeff()};
+    Eigen::Map<Array> c_map(c, n_c);
+    if (scale_a == 0 || scale_b == 0) {
+      c_map.setZero();
+      return;
+    }
+    Array z_re(Array::Zero(n)), z_im(Array::Zero(n));
+    z_re.head(n_a) = Eigen::Map<const Array>(a, n_a) / scale_a;
+    z_im.head(n_b) = Eigen::Map<const Array>(b, n_b) / scale_b;
+
+    // Twiddle factors of all the stages, the stage with butterflies of half
+    // size h uses w_k = exp(-2 pi i k / (2 h)) for k < h, stored from h - 1.
+    // The last stage is computed from the first quarter of the unit circle,
+    // since w_(k + n/4) = -i w_k, and the others are its strided copies.
+    Array w_re(n), w_im(n);
+    Integer h_last{n / 2}, q{n / 4};
+    for (Integer k{0}; k < q; ++k) {
+      Real t{-2 * std::numbers::pi_v<Real> * k / n};
+      Real cos_t{std::cos(t)}, sin_t{std::sin(t)};
+      w_re[h_last - 1 + k]     = cos_t;
+      w_im[h_last - 1 + k]     = sin_t;
+      w_re[h_last - 1 + k + q] = sin_t;
+      w_im[h_last - 1 + k + q] = -cos_t;
+    }
+    for (Integer h{h_last / 2}; h >= 1; h /= 2) {
+      Integer stride{h_last / h};
+      for (Integer k{0}; k < h; ++k) {
+        w_re[h - 1 + k] = w_re[h_last - 1 + k * stride];
+        w_im[h - 1 + k] = w_im[h_last - 1 + k * stride];
+      }
+    }
+
+    // Radix-2 in-place FFT on split real and imaginary parts. Swapping the
+    // parts gives the (unscaled) inverse transform.
+    auto fft = [n, &w_re, &w_im](Real *re, Real *im) {
+      for (Integer i{1}, j{0}; i < n; ++i) {
+        Integer bit{n >> 1};
+        for (; j & bit; bit >>= 1) {
+          j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+          std::swap(re[i], re[j]);
+          std::swap(im[i], im[j]);
+        }
+      }
+      for (Integer h{1}; h < n; h *= 2) {
+        const Real *wr{w_re.data() + h - 1}, *wi{w_im.data() + h - 1};
+        for (Integer i{0}; i < n; i += 2 * h) {
+          Real *re_0{re + i}, *im_0{im + i};
+          Real *re_1{re + i + h}, *im_1{im + i + h};
+          for (Integer k{0}; k < h; ++k) {
+            Real t_re{wr[k] * re_1[k] - wi[k] * im_1[k]};
+            Real t_im{wr[k] * im_1[k] + wi[k] * re_1[k]};
+            re_1[k] = re_0[k] - t_re;
+            im_1[k] = im_0[k] - t_im;
+            re_0[k] += t_re;
+            im_0[k] += t_im;
+          }
+        }
+      }
+    };
+
+    // a * b = Im(z * z) / 2
+    fft(z_re.data(), z_im.data());
+    Array z_sq_re(z_re.square() - z_im.square());
+    z_im = 2 * z_re * z_im;
+    fft(z_im.data(), z_sq_re.data());
+    c_map = z_im.head(n_c) * (scale_a * scale_b / static_cast<Real>(2 * n));
+  }
+
+}  // namespace Sturm
+
+#endif  // INCLUDE_STURM_MULTIPLY_HH
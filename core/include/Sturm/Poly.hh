@@ -14,27 +14,288 @@
 #define INCLUDE_STURM_POLY_HH
 
 #include "Sturm.hh"
+#include "Sturm/Inverse.hh"
+#include "Sturm/Multiply.hh"
 
 namespace Sturm {
 
+  /**
+   * \brief Evaluation strategy of a polynomial at a point.
+   *
+   * The compensated and the double-word variants of Horner's scheme are as
+   * accurate as the native one computed in twice the working precision, i.e.,
+   * their relative error is about \f$ u + \kappa u^2 \f$ instead of \f$
+   * \kappa u \f$, with \f$ u \f$ the unit roundoff and \f$ \kappa \f$ the
+   * condition number of the evaluation.
+   */
+  enum class Evaluation {
+    NATIVE,       /**< Horner's scheme in the working precision. */
+    COMPENSATED,  /**< Compensated Horner's scheme. */
+    DOUBLE_DOUBLE /**< Horner's scheme in double-word arithmetic. */
+  };
+
   /**
    * \brief Polynomial class.
    *
    * This class implements a polynomial of the form \f$ p(x) = \sum_{i=0}^n a_i
-   * x^i \f$.
+   * x^i \f$. When the maximum degree is given at compile time, the
+   * coefficients are stored in a fixed-capacity Eigen vector, so that neither
+   * the polynomial nor the temporaries of the operations on it allocate on the
+   * heap. In this case, all the polynomials involved in an operation (results
+   * included) must have degree less than or equal to \c MaxDegree.
    * \tparam Real Scalar number type.
+   * \tparam MaxDegree Maximum degree of the polynomial (\c Eigen::Dynamic for
+   * no limit).
    */
-  template <typename Real>
-  class Poly : public Eigen::Vector<Real, Eigen::Dynamic> {
+  template <typename Real, Integer MaxDegree = Eigen::Dynamic>
+  class Poly : public Eigen::Matrix<Real,
+                                    Eigen::Dynamic,
+                                    1,
+                                    Eigen::ColMajor,
+                                    MaxDegree == Eigen::Dynamic ? Eigen::Dynamic
+                                                                : MaxDegree + 1,
+                                    1> {
    public:
-    using Vector =
-        Eigen::Vector<Real, Eigen::Dynamic>; /**< Vector of real numbers. */
+    constexpr static const Integer MAX_ORDER{
+      MaxDegree == Eigen::Dynamic
+          ? Eigen::Dynamic
+          : MaxDegree + 1}; /**< Maximum polynomial order. */
+    using Vector = Eigen::Matrix<Real,
+                                 Eigen::Dynamic,
+                                 1,
+                                 Eigen::ColMajor,
+                                 MAX_ORDER,
+                                 1>; /**< Vector of real numbers. */
     constexpr static const Real EPSILON{
       std::numeric_limits<Real>::epsilon()}; /**< Machine epsilon. */
+    constexpr static const Integer BLOCK_SIZE{
+      512}; /**< Points per block in batched evaluations. */
 
    private:
     Integer m_order;                         /**< Polynomial order. */
 
+    /**
+     * \brief Replace \f$ q(x) \f$ with \f$ q(w x) \f$ and \f$ m(x) \f$ with
+     * \f$ m(|w| x) \f$, both scaled by the powers of two that normalize \f$
+     * m(x) \f$, see \c dilate(w).
+     * \param[in,out] q Polynomial.
+     * \param[in,out] m Magnitudes of the terms of the polynomial.
+     * \param[in] w Scaling.
+     */
+    static void dilate(Poly &q, Poly &m, Real w) {
+      Integer n{q.order()};
+      int e_max{std::numeric_limits<int>::min()}, e_w, e_i;
+      Real m_w{1.0};
+      for (Integer i{0}, e{0}; i < n; ++i) {
+        if (m.coeff(i) != 0) {
+          std::frexp(m.coeff(i) * m_w, &e_i);
+          e_max = std::max(e_max, e_i + e);
+        }
+        m_w = std::frexp(m_w * std::abs(w), &e_w);
+        e += e_w;
+      }
+      if (e_max == std::numeric_limits<int>::min()) {
+        return;
+      }
+      m_w = 1.0;
+      for (Integer i{0}, e{0}; i < n; ++i) {
+        m.coeffRef(i) = std::ldexp(m.coeff(i) * m_w, e - e_max);
+        q.coeffRef(i) = std::ldexp(q.coeff(i) * m_w, e - e_max);
+        if (w < 0 && i % 2 == 1) {
+          q.coeffRef(i) = -q.coeff(i);
+        }
+        m_w = std::frexp(m_w * std::abs(w), &e_w);
+        e += e_w;
+      }
+    }
+
+    /**
+     * \brief Replace \f$ q(x) \f$ with \f$ q(x + t) \f$ and \f$ m(x) \f$ with
+     * \f$ m(x + |t|) \f$.
+     * \param[in,out] q Polynomial.
+     * \param[in,out] m Magnitudes of the terms of the polynomial.
+     * \param[in] t Shift.
+     */
+    static void taylor_shift(Poly &q, Poly &m, Real t) {
+      q.taylor_shift(t);
+      m.taylor_shift(std::abs(t));
+    }
+
+    /**
+     * \brief Widen a root bound computed with the logarithm estimates of \c
+     * log_coeffs(...). The bounds are powers of differences of two estimates,
+     * whose error is below 1/64, so that they are widened by \f$ 2^{1/32} \f$,
+     * which also covers the rounding errors.
+     * \param[in] bound Root bound.
+     * \return The widened bound.
+     */
+    static Real widen_bound(Real bound) {
+      return bound * static_cast<Real>(1.022);
+    }
+
+    /**
+     * \brief Estimate the base-two logarithms of the absolute values of the
+     * coefficients, for the root bounds.
+     *
+     * Writing \f$ |a_i| = (1 + t) 2^e \f$ with \f$ t \in [0, 1) \f$, the
+     * estimate is \f$ e + t (1 + 0.347 (1 - t)) \f$, whose error is below
+     * 0.008. This is several times cheaper than \c std::log2, whose cost
+     * would be comparable to the bisection steps saved by the bounds.
+     * \param[out] log_a Logarithms (zero for the null coefficients, which the
+     * bounds skip).
+     */
+    void log_coeffs(Vector &log_a) const {
+      log_a.resize(this->m_order);
+      for (Integer i{0}; i < this->m_order; ++i) {
+        Real a{std::abs(this->coeff(i))};
+        if (a > 0) {
+          int e;
+          Real t{2 * std::frexp(a, &e) - 1};
+          log_a.coeffRef(i) =
+              (e - 1) + t * (1 + static_cast<Real>(0.347) * (1 - t));
+        } else {
+          log_a.coeffRef(i) = 0;
+        }
+      }
+    }
+
+    /**
+     * \brief Compute the logarithms of the ratios \f$ |a_{n-k}/a_n|^{1/k} \f$,
+     * for \f$ k = 1, \dots, n \f$, on which the \f$ O(n) \f$ root bounds are
+     * built.
+     * \param[out] log_r Logarithms of the ratios, at index \f$ k \f$ (minus
+     * infinity for the null coefficients).
+     */
+    void log_ratios(Vector &log_r) const {
+      Integer n{this->m_order - 1};
+      this->log_coeffs(log_r);
+      log_r.reverseInPlace();
+      for (Integer k{1}; k <= n; ++k) {
+        log_r.coeffRef(k) = this->coeff(n - k) != 0
+                                ? (log_r.coeff(k) - log_r.coeff(0)) / k
+                                : -std::numeric_limits<Real>::infinity();
+      }
+    }
+
+    /**
+     * \brief Compute Fujiwara's bound, see \c fujiwara_bound().
+     * \param[in] log_r Logarithms of the ratios, see \c log_ratios(...).
+     * \return The bound.
+     */
+    Real fujiwara_bound(const Vector &log_r) const {
+      Integer n{this->m_order - 1};
+      if (n < 1) {
+        return 0;
+      }
+      Real log_max{log_r.coeff(n) - static_cast<Real>(1.0) / n};
+      for (Integer k{1}; k < n; ++k) {
+        log_max = std::max(log_max, log_r.coeff(k));
+      }
+      return widen_bound(std::exp2(log_max + 1));
+    }
+
+    /**
+     * \brief Compute the Lagrange-Zassenhaus bound, see \c lagrange_bound().
+     * \param[in] log_r Logarithms of the ratios, see \c log_ratios(...).
+     * \return The bound.
+     */
+    Real lagrange_bound(const Vector &log_r) const {
+      Integer n{this->m_order - 1};
+      if (n < 1) {
+        return 0;
+      }
+      Real log_1{-std::numeric_limits<Real>::infinity()}, log_2{log_1};
+      for (Integer k{1}; k <= n; ++k) {
+        if (log_r.coeff(k) > log_1) {
+          log_2 = log_1;
+          log_1 = log_r.coeff(k);
+        } else if (log_r.coeff(k) > log_2) {
+          log_2 = log_r.coeff(k);
+        }
+      }
+      return widen_bound(std::exp2(log_1) + std::exp2(log_2));
+    }
+
+    /**
+     * \brief Compute Kioustelidis' bound, see \c kioustelidis_bound(...).
+     * \param[in] log_r Logarithms of the ratios, see \c log_ratios(...).
+     * \param[in] negative True for the bound on the negative roots.
+     * \return The bound.
+     */
+    Real kioustelidis_bound(const Vector &log_r, bool negative) const {
+      Integer n{this->m_order - 1};
+      if (n < 1) {
+        return 0;
+      }
+      Real log_max{-std::numeric_limits<Real>::infinity()};
+      for (Integer k{1}; k <= n; ++k) {
+        if (this->reflected_sign(n - k, negative) < 0) {
+          log_max = std::max(log_max, log_r.coeff(k));
+        }
+      }
+      return widen_bound(std::exp2(log_max + 1));
+    }
+
+    /**
+     * \brief Compute the local-max quadratic bound, see \c
+     * local_max_bound(...).
+     * \param[in] log_a Logarithms of the coefficients.
+     * \param[in] negative True for the bound on the negative roots.
+     * \return The bound.
+     */
+    Real local_max_bound(const Vector &log_a, bool negative) const {
+      Integer n{this->m_order - 1};
+      if (n < 1) {
+        return 0;
+      }
+      // Signs, pairing counters and reciprocals of the degree differences,
+      // so that the quadratic loop has neither branches on the signs of the
+      // coefficients nor divisions
+      Eigen::Matrix<Integer, Eigen::Dynamic, 1, Eigen::ColMajor, MAX_ORDER, 1>
+          sign(n + 1), t(n + 1);
+      Vector inv(n + 1);
+      for (Integer i{0}; i <= n; ++i) {
+        sign.coeffRef(i) = this->reflected_sign(i, negative);
+        inv.coeffRef(i)  = i > 0 ? 1 / static_cast<Real>(i) : 0;
+      }
+      t.setOnes();
+      Real log_max{-std::numeric_limits<Real>::infinity()};
+      for (Integer i{0}; i < n; ++i) {
+        if (sign.coeff(i) >= 0) {
+          continue;
+        }
+        Real log_min{std::numeric_limits<Real>::infinity()};
+        Integer j_min{n};
+        for (Integer j{i + 1}; j <= n; ++j) {
+          Real q{(t.coeff(j) + log_a.coeff(i) - log_a.coeff(j)) *
+                 inv.coeff(j - i)};
+          if (sign.coeff(j) > 0 && q < log_min) {
+            log_min = q;
+            j_min   = j;
+          }
+        }
+        ++t.coeffRef(j_min);
+        log_max = std::max(log_max, log_min);
+      }
+      return widen_bound(std::exp2(log_max));
+    }
+
+    /**
+     * \brief Sign of the \f$ i \f$-th coefficient of \f$ p(x) \f$, or of \f$
+     * p(-x) \f$, scaled to a positive leading coefficient.
+     * \param[in] i Index of the coefficient.
+     * \param[in] negative True for the coefficients of \f$ p(-x) \f$.
+     * \return The sign of the coefficient.
+     */
+    Integer reflected_sign(Integer i, bool negative) const {
+      Integer n{this->m_order - 1};
+      Real s{this->coeff(i) * this->coeff(n)};
+      if (negative && (n - i) % 2 == 1) {
+        s = -s;
+      }
+      return s > 0 ? 1 : (s < 0 ? -1 : 0);
+    }
+
     /**
      * \brief Access to the Eigen class.
      * \return The Eigen class.
@@ -270,6 +531,157 @@ namespace Sturm {
       p = p * x + this->coeff(0);
     }
 
+    /**
+     * \brief Evaluate the polynomial at a given point with the compensated
+     * Horner scheme.
+     *
+     * The rounding errors of each product and sum of Horner's scheme are
+     * computed exactly by error-free transformations (the product by a fused
+     * multiply-add, the sum by Knuth's two-sum), and their contribution is
+     * evaluated alongside and added to the result, which is then as accurate
+     * as if computed in twice the working precision (see Langlois and Louvet,
+     * "How to ensure a faithful polynomial evaluation with the compensated
+     * Horner algorithm", 2007). The a-posteriori error bound of the same
+     * paper is returned as well, underflow aside.
+     * \param[in] x Point at which to evaluate the polynomial.
+     * \param[out] error Bound on the error of the value.
+     * \return Value of the polynomial at the given point.
+     */
+    Real evaluate_compensated(Real x, Real &error) const {
+      Integer n{this->m_order - 1};
+      Real s{this->coeff(n)}, c{0.0}, b{0.0}, abs_x{std::abs(x)};
+      for (Integer i{n - 1}; i >= 0; --i) {
+        Real p{s * x};
+        Real pi{std::fma(s, x, -p)};
+        s = p + this->coeff(i);
+        Real z{s - p};
+        Real sigma{(p - (s - z)) + (this->coeff(i) - z)};
+        c = c * x + (pi + sigma);
+        b = b * abs_x + (std::abs(pi) + std::abs(sigma));
+      }
+      Real r{s + c};
+      constexpr Real u{EPSILON / 2};
+      Real gamma{2 * n * u / (1 - 2 * n * u)};
+      error = u * std::abs(r) +
+              (gamma * b + 2 * u * u * std::abs(r)) / (1 - 2 * (n + 1) * u);
+      return r;
+    }
+
+    /**
+     * \brief Evaluate the polynomial at a given point in double-word
+     * arithmetic.
+     *
+     * Horner's scheme is run on unevaluated sums \f$ h + l \f$ of two numbers
+     * of the working precision (double-double for \c double, float-float for
+     * \c float), renormalized after each step, and each product and sum is
+     * made exact up to a rounding of the low word by the same error-free
+     * transformations as \c evaluate_compensated(...). The accuracy is about
+     * the same, at the cost of the renormalization.
+     * \param[in] x Point at which to evaluate the polynomial.
+     * \return Value of the polynomial at the given point.
+     */
+    Real evaluate_double_double(Real x) const {
+      Integer n{this->m_order - 1};
+      Real h{this->coeff(n)}, l{0.0};
+      while (n-- > 0) {
+        Real p{h * x};
+        Real e{std::fma(h, x, -p) + l * x};
+        Real s{p + this->coeff(n)};
+        Real z{s - p};
+        Real t{(p - (s - z)) + (this->coeff(n) - z) + e};
+        h = s + t;
+        l = t - (h - s);
+      }
+      return h + l;
+    }
+
+    /**
+     * \brief Evaluate the polynomial at a given point with a given strategy.
+     * \param[in] x Point at which to evaluate the polynomial.
+     * \param[in] evaluation Evaluation strategy.
+     * \return Value of the polynomial at the given point.
+     */
+    Real evaluate(Real x, Evaluation evaluation) const {
+      Real error;
+      switch (evaluation) {
+        case Evaluation::COMPENSATED:
+          return this->evaluate_compensated(x, error);
+        case Evaluation::DOUBLE_DOUBLE:
+          return this->evaluate_double_double(x);
+        default:
+          return this->evaluate(x);
+      }
+    }
+
+    /**
+     * \brief Evaluate the polynomial at a batch of points.
+     *
+     * Horner's scheme is run across the points rather than point by point. The
+     * points are processed in blocks of \c BLOCK_SIZE so that each block stays
+     * in cache for the whole scheme, and every Horner step over a block is an
+     * Eigen array expression mapped onto the SIMD lanes of the target
+     * (SSE/AVX for \c float and \c double).
+     * \param[in] x Points at which to evaluate the polynomial.
+     * \param[out] p Values of the polynomial at the given points.
+     */
+    void evaluate(std::span<const Real> x, std::span<Real> p) const {
+      STURM_ASSERT(x.size() == p.size(),
+                   "Sturm::Poly::evaluate(...): input and output sizes do not "
+                   "match.");
+      using Array = Eigen::Array<Real, Eigen::Dynamic, 1>;
+      Integer n_points{static_cast<Integer>(x.size())};
+      for (Integer i{0}; i < n_points; i += BLOCK_SIZE) {
+        Integer n_block{std::min(BLOCK_SIZE, n_points - i)};
+        Eigen::Map<const Array> x_block(x.data() + i, n_block);
+        Eigen::Map<Array> p_block(p.data() + i, n_block);
+        if (this->m_order <= 0) {
+          p_block.setZero();
+          continue;
+        }
+        Integer n{this->m_order - 1};
+        p_block.setConstant(this->coeff(n));
+        while (n-- > 0) {
+          p_block = p_block * x_block + this->coeff(n);
+        }
+      }
+    }
+
+    /**
+     * \brief Evaluate the polynomial and its derivative at a batch of points.
+     *
+     * Batched counterpart of \c evaluate(Real, Real &, Real &), see the
+     * batched \c evaluate(...) for the blocking strategy.
+     * \param[in] x Points at which to evaluate.
+     * \param[out] p Values of the polynomial at the given points.
+     * \param[out] Dp Values of the derivative at the given points.
+     */
+    void evaluate(std::span<const Real> x,
+                  std::span<Real> p,
+                  std::span<Real> Dp) const {
+      STURM_ASSERT(x.size() == p.size() && x.size() == Dp.size(),
+                   "Sturm::Poly::evaluate(...): input and output sizes do not "
+                   "match.");
+      using Array = Eigen::Array<Real, Eigen::Dynamic, 1>;
+      Integer n_points{static_cast<Integer>(x.size())};
+      for (Integer i{0}; i < n_points; i += BLOCK_SIZE) {
+        Integer n_block{std::min(BLOCK_SIZE, n_points - i)};
+        Eigen::Map<const Array> x_block(x.data() + i, n_block);
+        Eigen::Map<Array> p_block(p.data() + i, n_block);
+        Eigen::Map<Array> Dp_block(Dp.data() + i, n_block);
+        Dp_block.setZero();
+        if (this->m_order <= 0) {
+          p_block.setZero();
+          continue;
+        }
+        Integer n{this->m_order - 1};
+        p_block.setConstant(this->coeff(n));
+        while (n-- > 0) {
+          Dp_block = Dp_block * x_block + p_block;
+          p_block  = p_block * x_block + this->coeff(n);
+        }
+      }
+    }
+
     /**
      * \brief Get the leading coefficient of the polynomial.
      * \return Leading coefficient.
@@ -394,6 +806,297 @@ namespace Sturm {
       return sign_var;
     }
 
+    /**
+     * \brief Replace \f$ p(x) \f$ with \f$ p(x + t) \f$.
+     * \param[in] t Shift.
+     */
+    void taylor_shift(Real t) {
+      Integer n{this->m_order - 1};
+      for (Integer i{0}; i < n; ++i) {
+        for (Integer j{n - 1}; j >= i; --j) {
+          this->coeffRef(j) += t * this->coeff(j + 1);
+        }
+      }
+    }
+
+    /**
+     * \brief Replace \f$ p(x) \f$ with \f$ p(w x) \f$, normalized.
+     *
+     * The powers of \f$ w \f$ are accumulated as mantissa and exponent, and
+     * the coefficients are scaled by a power of two so that the largest one
+     * has an absolute value in \f$ [1/2, 1) \f$. The coefficients that
+     * underflow are negligible with respect to the largest one.
+     * \param[in] w Scaling.
+     */
+    void dilate(Real w) {
+      Integer n{this->m_order};
+      int e_max{std::numeric_limits<int>::min()}, e_w, e_i;
+      Real m_w{1.0};
+      for (Integer i{0}, e{0}; i < n; ++i) {
+        if (this->coeff(i) != 0) {
+          std::frexp(this->coeff(i) * m_w, &e_i);
+          e_max = std::max(e_max, e_i + e);
+        }
+        m_w = std::frexp(m_w * w, &e_w);
+        e += e_w;
+      }
+      if (e_max == std::numeric_limits<int>::min()) {
+        return;
+      }
+      m_w = 1.0;
+      for (Integer i{0}, e{0}; i < n; ++i) {
+        this->coeffRef(i) = std::ldexp(this->coeff(i) * m_w, e - e_max);
+        m_w               = std::frexp(m_w * w, &e_w);
+        e += e_w;
+      }
+    }
+
+    /**
+     * \brief Map the interval \f$ (a, b) \f$ onto \f$ (0, 1) \f$.
+     *
+     * Compute \f$ q(x) = p(a + (b - a) x) \f$, normalized. The Taylor shift
+     * is always by a number of absolute value at most one: by \f$ a/w \f$
+     * after scaling by \f$ w = b - a \f$ if \f$ |a| \leq w \f$, or by one
+     * after scaling by \f$ a \f$ and before scaling by \f$ w/a \f$ otherwise.
+     * \param[in] a Lower bound of the interval.
+     * \param[in] b Upper bound of the interval.
+     * \param[out] q Polynomial on \f$ (0, 1) \f$.
+     */
+    void map_interval(Real a, Real b, Poly &q) const {
+      Real w{b - a};
+      q = *this;
+      if (std::abs(a) <= w) {
+        q.dilate(w);
+        if (a != 0) {
+          q.taylor_shift(a / w);
+        }
+      } else {
+        q.dilate(a);
+        q.taylor_shift(1);
+        q.dilate(w / a);
+      }
+    }
+
+    /**
+     * \brief Map the interval \f$ (a, b) \f$ onto \f$ (0, \infty) \f$.
+     *
+     * Compute the Mobius transform \f$ q(x) = (x + 1)^n p((a x + b)/(x + 1))
+     * \f$, whose positive roots are the images of the roots of \f$ p(x) \f$ in
+     * \f$ (a, b) \f$. By Descartes' rule of signs, the sign variations of the
+     * coefficients of \f$ q(x) \f$ exceed the number of such roots by an even
+     * number, hence they are exact when they are zero or one.
+     * \param[in] a Lower bound of the interval.
+     * \param[in] b Upper bound of the interval.
+     * \param[out] q Transformed polynomial.
+     */
+    void mobius(Real a, Real b, Poly &q) const {
+      this->map_interval(a, b, q);
+      q.to_eigen().reverseInPlace();
+      q.taylor_shift(1);
+    }
+
+    /**
+     * \brief Map the interval \f$ (a, b) \f$ onto \f$ (0, \infty) \f$, with
+     * a bound on the rounding errors.
+     *
+     * Same as \c mobius(a, b, q), but the operations are repeated on the
+     * absolute values of the coefficients and of the shifts, and the two
+     * polynomials are scaled by the same powers of two. The \f$ i \f$-th
+     * coefficient of \f$ m(x) \f$ bounds all the terms summed into the one of
+     * \f$ q(x) \f$, so that the rounding error of the latter is below \f$ 2 n
+     * \epsilon \f$ times the former, up to higher order terms.
+     * \param[in] a Lower bound of the interval.
+     * \param[in] b Upper bound of the interval.
+     * \param[out] q Transformed polynomial.
+     * \param[out] m Magnitudes of the terms of the transformed polynomial.
+     */
+    void mobius(Real a, Real b, Poly &q, Poly &m) const {
+      this->map_interval(a, b, q, m);
+      q.to_eigen().reverseInPlace();
+      m.to_eigen().reverseInPlace();
+      taylor_shift(q, m, 1);
+    }
+
+    /**
+     * \brief Map the interval \f$ (a, b) \f$ onto \f$ (0, 1) \f$, with a
+     * bound on the rounding errors, see \c mobius(a, b, q, m).
+     * \param[in] a Lower bound of the interval.
+     * \param[in] b Upper bound of the interval.
+     * \param[out] q Polynomial on \f$ (0, 1) \f$.
+     * \param[out] m Magnitudes of the terms of the polynomial on \f$ (0, 1)
+     * \f$.
+     */
+    void map_interval(Real a, Real b, Poly &q, Poly &m) const {
+      Real w{b - a};
+      q            = *this;
+      m            = *this;
+      m.to_eigen() = m.cwiseAbs();
+      if (std::abs(a) <= w) {
+        dilate(q, m, w);
+        if (a != 0) {
+          taylor_shift(q, m, a / w);
+        }
+      } else {
+        dilate(q, m, a);
+        taylor_shift(q, m, 1);
+        dilate(q, m, w / a);
+      }
+    }
+
+    /**
+     * \brief Count the roots in the disc of diameter \f$ [a, b] \f$ by
+     * Pellet's test.
+     *
+     * Let \f$ g(x) = p(c + r x) = \sum_i g_i x^i \f$, with \f$ c = (a + b)/2
+     * \f$ and \f$ r = (b - a)/2 \f$. If \f$ |g_k| > \sum_{i \neq k} |g_i| \f$,
+     * then \f$ p(x) \f$ has exactly \f$ k \f$ roots, complex ones and
+     * multiplicities included, in the disc \f$ |x - c| < r \f$ (Pellet's
+     * theorem). The rounding errors of the coefficients, bounded as in \c
+     * mobius(a, b, q, m), are charged against the test.
+     * \param[in] a Lower bound of the interval.
+     * \param[in] b Upper bound of the interval.
+     * \param[out] g Workspace for the polynomial on the disc.
+     * \param[out] m Workspace for the magnitudes of its terms.
+     * \return The number of roots in the disc, or -1 if the test fails.
+     */
+    Integer pellet(Real a, Real b, Poly &g, Poly &m) const {
+      this->map_interval(a, b, g, m);
+      taylor_shift(g, m, 0.5);
+      dilate(g, m, 0.5);
+      Real tolerance{4 * static_cast<Real>(g.order()) *
+                     std::numeric_limits<Real>::epsilon()};
+      // |g_k| - e_k > sum of |g_i| + e_i over i != k
+      Real sum{(g.cwiseAbs() + tolerance * m.to_eigen()).sum()};
+      for (Integer k{0}; k < g.order(); ++k) {
+        if (2 * std::abs(g.coeff(k)) > sum) {
+          return k;
+        }
+      }
+      return -1;
+    }
+
+    /**
+     * \brief Compute Cauchy's bound on the absolute value of the roots.
+     *
+     * All the roots satisfy \f$ |x| < 1 + \max_{i < n} |a_i| / |a_n| \f$.
+     * \return The bound (zero for constant polynomials).
+     */
+    Real cauchy_bound() const {
+      Integer n{this->m_order - 1};
+      if (n < 1) {
+        return 0;
+      }
+      Real max{this->head(n).cwiseAbs().maxCoeff()};
+      return 1 + max / std::abs(this->coeff(n));
+    }
+
+    /**
+     * \brief Compute Fujiwara's bound on the absolute value of the roots.
+     *
+     * All the roots satisfy \f$ |x| \leq 2 \max \{ |a_{n-1}/a_n|, |a_{n-2}/
+     * a_n|^{1/2}, \dots, |a_1/a_n|^{1/(n-1)}, |a_0/(2 a_n)|^{1/n} \} \f$. The
+     * powers are computed on the logarithms, so that they do not overflow,
+     * and the bound is widened by about 2% for the errors of the logarithms.
+     * \return The bound (zero for constant polynomials).
+     */
+    Real fujiwara_bound() const {
+      Vector log_r;
+      this->log_ratios(log_r);
+      return this->fujiwara_bound(log_r);
+    }
+
+    /**
+     * \brief Compute the Lagrange-Zassenhaus bound on the absolute value of
+     * the roots.
+     *
+     * All the roots satisfy \f$ |x| \leq \rho_1 + \rho_2 \f$, where \f$ \rho_1
+     * \geq \rho_2 \f$ are the two largest values of \f$ |a_{n-k}/a_n|^{1/k}
+     * \f$ for \f$ k = 1, \dots, n \f$.
+     * \return The bound (zero for constant polynomials).
+     */
+    Real lagrange_bound() const {
+      Vector log_r;
+      this->log_ratios(log_r);
+      return this->lagrange_bound(log_r);
+    }
+
+    /**
+     * \brief Compute Kioustelidis' bound on the positive (or negative) roots.
+     *
+     * With \f$ a_n > 0 \f$, all the positive roots satisfy \f$ x \leq 2
+     * \max_{a_{n-k} < 0} (-a_{n-k}/a_n)^{1/k} \f$. The bound on the negative
+     * roots is the one on the positive roots of \f$ p(-x) \f$.
+     * \param[in] negative True for the bound \f$ B \f$ on the negative roots,
+     * i.e., \f$ x \geq -B \f$.
+     * \return The bound (zero if there are no positive or negative roots).
+     */
+    Real kioustelidis_bound(bool negative = false) const {
+      Vector log_r;
+      this->log_ratios(log_r);
+      return this->kioustelidis_bound(log_r, negative);
+    }
+
+    /**
+     * \brief Compute the local-max quadratic bound on the positive (or
+     * negative) roots.
+     *
+     * With \f$ a_n > 0 \f$, each negative coefficient \f$ a_i \f$ is paired
+     * with the positive coefficient \f$ a_j \f$, \f$ j > i \f$, minimizing \f$
+     * (-2^{t_j} a_i / a_j)^{1/(j-i)} \f$, where \f$ t_j \f$ counts the times
+     * \f$ a_j \f$ has been paired, starting from one. Since the fractions
+     * \f$ 2^{-t_j} \f$ of each positive coefficient sum to less than one, the
+     * polynomial is positive beyond the largest of these values (Akritas,
+     * Strzebonski and Vigklas). The bound is usually much sharper than
+     * Kioustelidis' one. The bound on the negative roots is the one on the
+     * positive roots of \f$ p(-x) \f$.
+     * \param[in] negative True for the bound \f$ B \f$ on the negative roots,
+     * i.e., \f$ x \geq -B \f$.
+     * \return The bound (zero if there are no positive or negative roots).
+     */
+    Real local_max_bound(bool negative = false) const {
+      Vector log_a;
+      this->log_coeffs(log_a);
+      return this->local_max_bound(log_a, negative);
+    }
+
+    /**
+     * \brief Compute an interval containing all the real roots.
+     *
+     * When the largest ratio \f$ M = \max_{i < n} |a_i| / |a_n| \f$ is within
+     * a factor \c STURM_ROOT_BOUNDS_SPREAD of one, the coefficients are well
+     * scaled and Cauchy's bound \f$ 1 + M \f$ is already close, so it is used
+     * on both sides. Otherwise, the bounds are the tightest among the Cauchy,
+     * Fujiwara and Lagrange-Zassenhaus bounds on the absolute value of the
+     * roots, and the Kioustelidis bounds on the positive and negative roots,
+     * so that the interval is not symmetric when the real roots are not. All
+     * of them cost \f$ O(n) \f$ operations on the logarithms of the ratios of
+     * the coefficients, which are computed once, but together they cost about
+     * two evaluations of the Sturm sequence at low degree. The local-max
+     * quadratic bound costs \f$ O(n^2) \f$ and it is left out since it is
+     * seldom sharp enough to save more than that.
+     * \param[out] a Lower bound of the interval.
+     * \param[out] b Upper bound of the interval.
+     */
+    void root_bounds(Real &a, Real &b) const {
+      if (this->m_order < 2) {
+        a = b = 0;
+        return;
+      }
+      Real cauchy{this->cauchy_bound()};
+      Real spread{static_cast<Real>(STURM_ROOT_BOUNDS_SPREAD)};
+      if (cauchy - 1 <= spread && (cauchy - 1) * spread >= 1) {
+        a = -cauchy;
+        b = cauchy;
+        return;
+      }
+      Vector log_r;
+      this->log_ratios(log_r);
+      Real bound{std::min(
+          {cauchy, this->fujiwara_bound(log_r), this->lagrange_bound(log_r)})};
+      a = -std::min(bound, this->kioustelidis_bound(log_r, true));
+      b = std::min(bound, this->kioustelidis_bound(log_r, false));
+    }
+
     /**
      * \brief Normalize the polynomial to monic form.
      *
@@ -469,18 +1172,37 @@ namespace Sturm {
 
     /**
      * \brief Define the multiplication with another polynomial.
+     *
+     * Small products are computed in place, from the highest coefficient down
+     * so that each coefficient is overwritten only once it is no longer
+     * needed. Larger products go through \c multiply(...).
      * \param[in] p Polynomial to multiply.
      * \return Reference to the polynomial.
      */
     Poly &operator*=(const Poly &p) {
-      Vector a(this->to_eigen());
-      Integer new_order{this->m_order + p.m_order - 1};
-      this->resize(new_order);
-      this->setZero();
-      for (Integer i{0}; i < this->m_order; ++i) {
-        for (Integer j{0}; j < p.m_order; ++j) {
-          this->coeffRef(i + j) += a.coeff(i) * p.coeff(j);
+      Integer n_a{this->m_order}, n_b{p.m_order};
+      if (n_a == 0 || n_b == 0) {
+        this->set_order(0);
+        return *this;
+      }
+      Integer new_order{n_a + n_b - 1};
+      if (std::min(n_a, n_b) < STURM_KARATSUBA_THRESHOLD) {
+        this->conservativeResize(new_order);
+        // Aliasing is safe: p_k only reads a_i and b_j with i, j <= k
+        const Real *b{&p == this ? this->data() : p.data()};
+        for (Integer k{new_order - 1}; k >= 0; --k) {
+          Integer i_min{std::max(Integer(0), k - n_b + 1)};
+          Integer i_max{std::min(k, n_a - 1)};
+          Real c_k{0};
+          for (Integer i{i_min}; i <= i_max; ++i) {
+            c_k += this->coeff(i) * b[k - i];
+          }
+          this->coeffRef(k) = c_k;
         }
+      } else {
+        Vector c(new_order);
+        Sturm::multiply(this->data(), n_a, p.data(), n_b, c.data());
+        this->to_eigen().swap(c);
       }
       this->m_order = new_order;
       return *this;
@@ -536,12 +1258,14 @@ namespace Sturm {
    * \param[in] p_2 Second polynomial to sum.
    * \return The operation result.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline Poly<Real> operator+(const Poly<Real> &p_1, const Poly<Real> &p_2) {
+  template <typename Real, Integer N>
+  inline Poly<Real, N> operator+(const Poly<Real, N> &p_1,
+                                 const Poly<Real, N> &p_2) {
     Integer max_order{std::max(p_1.order(), p_2.order())};
     Integer min_order{std::min(p_1.order(), p_2.order())};
-    Poly<Real> res(max_order);
+    Poly<Real, N> res(max_order);
     res.head(min_order).noalias() = p_1.head(min_order) + p_2.head(min_order);
     Integer n_tail{max_order - min_order};
     if (n_tail > 0) {
@@ -560,11 +1284,12 @@ namespace Sturm {
    * \param[in] s Scalar to sum.
    * \return The operation result.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline Poly<Real> operator+(const Poly<Real> &p, Real s) {
+  template <typename Real, Integer N>
+  inline Poly<Real, N> operator+(const Poly<Real, N> &p, Real s) {
     Integer max_order{std::max(p.order(), 1)};
-    Poly<Real> res(max_order);
+    Poly<Real, N> res(max_order);
     if (p.order() > 0) {
       res.coeffRef(0) = p.coeff(0) + s;
       if (p.order() > 1)
@@ -581,11 +1306,12 @@ namespace Sturm {
    * \param[in] p Polynomial to sum.
    * \return The operation result.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline Poly<Real> operator+(Real s, const Poly<Real> &p) {
+  template <typename Real, Integer N>
+  inline Poly<Real, N> operator+(Real s, const Poly<Real, N> &p) {
     Integer max_order{std::max(p.order(), 1)};
-    Poly<Real> res(max_order);
+    Poly<Real, N> res(max_order);
     if (p.order() > 0) {
       res.coeffRef(0) = s + p.coeff(0);
       if (p.order() > 1)
@@ -602,12 +1328,14 @@ namespace Sturm {
    * \param[in] p_2 Second polynomial to subtract.
    * \return The operation result.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline Poly<Real> operator-(const Poly<Real> &p_1, const Poly<Real> &p_2) {
+  template <typename Real, Integer N>
+  inline Poly<Real, N> operator-(const Poly<Real, N> &p_1,
+                                 const Poly<Real, N> &p_2) {
     Integer max_order{std::max(p_1.order(), p_2.order())};
     Integer min_order{std::min(p_1.order(), p_2.order())};
-    Poly<Real> res(max_order);
+    Poly<Real, N> res(max_order);
     res.head(min_order).noalias() = p_1.head(min_order) - p_2.head(min_order);
     Integer n_tail{max_order - min_order};
     if (n_tail > 0) {
@@ -626,11 +1354,12 @@ namespace Sturm {
    * \param[in] s Scalar to subtract.
    * \return The operation result.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline Poly<Real> operator-(const Poly<Real> &p, Real s) {
+  template <typename Real, Integer N>
+  inline Poly<Real, N> operator-(const Poly<Real, N> &p, Real s) {
     Integer max_order{std::max(p.order(), 1)};
-    Poly<Real> res(max_order);
+    Poly<Real, N> res(max_order);
     if (p.order() > 0) {
       res.coeffRef(0) = p.coeff(0) - s;
       if (p.order() > 1)
@@ -647,11 +1376,12 @@ namespace Sturm {
    * \param[in] p Polynomial to subtract.
    * \return The operation result.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline Poly<Real> operator-(Real s, const Poly<Real> &p) {
+  template <typename Real, Integer N>
+  inline Poly<Real, N> operator-(Real s, const Poly<Real, N> &p) {
     Integer max_order{std::max(p.order(), 1)};
-    Poly<Real> res(max_order);
+    Poly<Real, N> res(max_order);
     if (p.order() > 0) {
       res.coeffRef(0) = s - p.coeff(0);
       if (p.order() > 1) {
@@ -669,15 +1399,20 @@ namespace Sturm {
    * \param[in] p_2 Second polynomial to multiply.
    * \return The operation result.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline Poly<Real> operator*(const Poly<Real> &p_1, const Poly<Real> &p_2) {
-    Poly<Real> res(p_1.order() + p_2.order() - 1);
-    for (Integer i{0}; i < p_1.order(); ++i) {
-      for (Integer j{0}; j < p_2.order(); ++j) {
-        res.coeffRef(i + j) += p_1.coeff(i) * p_2.coeff(j);
-      }
+  template <typename Real, Integer N>
+  inline Poly<Real, N> operator*(const Poly<Real, N> &p_1,
+                                 const Poly<Real, N> &p_2) {
+    if (p_1.order() == 0 || p_2.order() == 0) {
+      return Poly<Real, N>();
     }
+    Poly<Real, N> res(p_1.order() + p_2.order() - 1);
+    Sturm::multiply(p_1.data(),
+                    p_1.order(),
+                    p_2.data(),
+                    p_2.order(),
+                    res.data());
     return res;
   }
 
@@ -687,10 +1422,11 @@ namespace Sturm {
    * \param[in] s Scalar to multiply.
    * \return The operation result.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline Poly<Real> operator*(Real p, const Poly<Real> &s) {
-    Poly<Real> res(s.order());
+  template <typename Real, Integer N>
+  inline Poly<Real, N> operator*(Real p, const Poly<Real, N> &s) {
+    Poly<Real, N> res(s.order());
     res.noalias() = p * s.to_eigen();
     return res;
   }
@@ -701,108 +1437,475 @@ namespace Sturm {
    * \param[in] p Polynomial to multiply.
    * \return The operation result.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline Poly<Real> operator*(const Poly<Real> &s, Real p) {
-    Poly<Real> res(s.order());
+  template <typename Real, Integer N>
+  inline Poly<Real, N> operator*(const Poly<Real, N> &s, Real p) {
+    Poly<Real, N> res(s.order());
     res.noalias() = s.to_eigen() * p;
     return res;
   }
 
   /**
-   * \brief Divide the polynomial.
+   * \brief Workspace for the polynomial division and greatest common divisor.
    *
-   * Divide the polynomial \f$ p_1(x) \f$ by \f$ p_2(x) \f$ with remainder \f$
-   * r(x) \f$ and quotient \f$ q(x) \f$.
-   * \param[in] p_1 Polynomial to divide.
-   * \param[in] p_2 Polynomial to divide by.
-   * \param[out] q Quotient polynomial.
-   * \param[out] r Remainder polynomial.
+   * This class owns the buffers used by \c divide(...) and \c GCD(...), which
+   * only grow. A workspace reused across calls with polynomials of similar
+   * order therefore performs no heap allocation after the first call (and
+   * never allocates when the maximum degree is given at compile time).
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline void divide(const Poly<Real> &p_1,
-                     const Poly<Real> &p_2,
-                     Poly<Real> &q,
-                     Poly<Real> &r) {
-    // Scale polynomials as p_1_norm(x) = p_1(x) / scale_p_1, and p_2_norm(x) =
-    // p_2(x) / scale_p_2
-    Poly<Real> p_1_norm(p_1), p_2_norm(p_2);
-    Real scale_p_1{p_1_norm.normalize()};
-    Real scale_p_2{p_2_norm.normalize()};
-
-    // p_1_norm(x) = p_2_norm(x) * q(x) + r(x)
-    r = p_1_norm;
-    Real leading_b_norm{p_2_norm.leading_coeff()};
-    Integer d{r.order() - p_2_norm.order()};
-    if (d < 0) {
-      // p_1_norm(x) = p_2_norm(x) + r(x)
-      q.set_scalar(1);
-      r = p_1_norm - p_2_norm;
-    } else {
-      Integer r_degree{r.degree()};
-      q.set_order(d + 1);
+  template <typename Real, Integer N = Eigen::Dynamic>
+  class DivideWorkspace {
+   public:
+    using Vector =
+        typename Poly<Real, N>::Vector; /**< Vector of real numbers. */
+
+   private:
+    Vector m_a;       /**< Dividend, overwritten by the remainder. */
+    Vector m_b;       /**< Divisor. */
+    Vector m_b_norm;  /**< Normalized divisor. */
+    Vector m_q;       /**< Quotient. */
+    Vector m_inv;     /**< Inverse of the reversed divisor. */
+    Integer m_n_a{0}; /**< Order of the dividend or remainder. */
+    Integer m_n_b{0}; /**< Order of the divisor. */
+    Integer m_n_q{0}; /**< Order of the quotient. */
+
+   public:
+    /**
+     * \brief Class constructor for the workspace.
+     */
+    DivideWorkspace() {}
+
+    /**
+     * \brief Make room for polynomials up to a given order.
+     * \param[in] order Maximum order of the polynomials.
+     */
+    void reserve(Integer order) {
+      if (this->m_a.size() < order) {
+        this->m_a.resize(order);
+        this->m_b.resize(order);
+        this->m_b_norm.resize(order);
+        this->m_q.resize(order);
+        this->m_inv.resize(order);
+      }
+    }
+
+    /**
+     * \brief Load the dividend \f$ p_1(x) \f$ and the divisor \f$ p_2(x) \f$.
+     * \param[in] p_1 Polynomial to divide.
+     * \param[in] p_2 Polynomial to divide by.
+     */
+    void load(const Poly<Real, N> &p_1, const Poly<Real, N> &p_2) {
+      this->m_n_a = p_1.order();
+      this->m_n_b = p_2.order();
+      this->reserve(std::max(this->m_n_a, this->m_n_b));
+      this->m_a.head(this->m_n_a) = p_1.to_eigen();
+      this->m_b.head(this->m_n_b) = p_2.to_eigen();
+    }
+
+    /**
+     * \brief Divide the loaded polynomials in place.
+     *
+     * The dividend buffer is overwritten with the remainder, and the quotient
+     * is stored in the workspace. The arithmetic is the same as in \c
+     * divide(...). When both the quotient and the remainder have order at
+     * least \c STURM_NEWTON_DIVIDE_THRESHOLD, the long division is replaced by
+     * the Newton inversion of the reversed divisor (see \c
+     * divide_inverse(...)).
+     */
+    void divide() {
+      Integer &n_a{this->m_n_a};
+      Integer n_b{this->m_n_b};
+      auto a{this->m_a.head(n_a)};
+      auto b_norm{this->m_b_norm.head(n_b)};
+
+      // Scale polynomials as a_norm(x) = a(x) / scale_a, and b_norm(x) =
+      // b(x) / scale_b
+      Real scale_a{n_a > 0 ? a.cwiseAbs().maxCoeff() : Real(0.0)};
+      if (scale_a > static_cast<Real>(0.0)) {
+        a /= scale_a;
+      }
+      b_norm = this->m_b.head(n_b);
+      Real scale_b{n_b > 0 ? b_norm.cwiseAbs().maxCoeff() : Real(0.0)};
+      if (scale_b > static_cast<Real>(0.0)) {
+        b_norm /= scale_b;
+      }
+
+      // a_norm(x) = b_norm(x) * q(x) + r(x)
+      Integer d{n_a - n_b};
+      if (d < 0) {
+        // a_norm(x) = b_norm(x) + r(x)
+        this->m_q.coeffRef(0) = 1;
+        this->m_n_q           = 1;
+        this->m_a.segment(n_a, n_b - n_a).setZero();
+        n_a = n_b;
+        this->m_a.head(n_a) -= b_norm;
+      } else {
+        Real leading_b_norm{b_norm.coeff(n_b - 1)};
+        Integer r_degree{n_a - 1};
+        this->m_n_q = d + 1;
+        this->m_q.head(this->m_n_q).setZero();
+
+        STURM_ASSERT(
+            std::abs(leading_b_norm) > (Poly<Real, N>::EPSILON),
+            "Sturm::Poly::divide(...): leading coefficient of p_2(x) is 0.");
+
+        // Fixed-capacity workspaces keep the allocation-free long division
+        bool newton{N == Eigen::Dynamic &&
+                    std::min(d + 1, n_b - 1) >= STURM_NEWTON_DIVIDE_THRESHOLD};
+        if (newton) {
+          Vector b_rev(b_norm.reverse());
+          Sturm::inverse_series(
+              b_rev.data(), n_b, this->m_inv.data(), 0, this->m_n_q);
+          Sturm::divide_inverse(this->m_a.data(),
+                                n_a,
+                                b_norm.data(),
+                                n_b,
+                                this->m_inv.data(),
+                                this->m_q.data(),
+                                this->m_a.data());
+          this->m_a.segment(n_b - 1, n_a - n_b + 1).setZero();
+        } else {
+          while (d >= 0 && r_degree >= 0) {
+            Real ratio{this->m_a.coeff(r_degree) / leading_b_norm};
+            this->m_q.coeffRef(d) = ratio;
+            this->m_a.segment(d, n_b - 1).noalias() -=
+                ratio * b_norm.head(n_b - 1);
+            this->m_a.coeffRef(r_degree) = 0;
+            --r_degree;
+            --d;
+          }
+        }
+
+        // Do not purge remainder: this can be done externally with purge(eps)
+        while (n_a > 0 && this->m_a.coeff(n_a - 1) == 0) {
+          --n_a;
+        }
+      }
+
+      // Scale back polinomials:
+      // - a_norm(x) = b_norm(x) * q(x) + r(x)
+      // - a(x) = b(x) * (scale_a/scale_b) * q(x) + scale_a*r(x)
+      this->m_q.head(this->m_n_q) *= scale_a / scale_b;
+      this->m_a.head(n_a) *= scale_a;
+    }
+
+    /**
+     * \brief Purge small coefficients of the remainder.
+     *
+     * Same as \c Poly::purge(...) applied to the remainder.
+     * \param[in] eps Epsilon value for purging coefficients.
+     */
+    void purge(Real eps) {
+      Integer &n_a{this->m_n_a};
+      if (n_a > 0) {
+        auto a{this->m_a.head(n_a)};
+        Real eps_tmp{eps * std::max(a.cwiseAbs().maxCoeff(), Real(1.0))};
+        a = (a.cwiseAbs().array() <= eps_tmp).select(Real(0.0), a);
+      }
+      while (n_a > 0 && this->m_a.coeff(n_a - 1) == 0) {
+        --n_a;
+      }
+    }
+
+    /**
+     * \brief Make the remainder the new divisor and the divisor the new
+     * dividend, as in a step of the Euclidean algorithm.
+     */
+    void shift() {
+      this->m_a.swap(this->m_b);
+      std::swap(this->m_n_a, this->m_n_b);
+    }
+
+    /**
+     * \brief Get the order of the remainder.
+     * \return The order of the remainder.
+     */
+    Integer remainder_order() const {
+      return this->m_n_a;
+    }
+
+    /**
+     * \brief Get the order of the divisor.
+     * \return The order of the divisor.
+     */
+    Integer divisor_order() const {
+      return this->m_n_b;
+    }
+
+    /**
+     * \brief Copy the quotient into a polynomial.
+     * \param[out] q Quotient polynomial.
+     */
+    void quotient(Poly<Real, N> &q) const {
+      q.set_order(this->m_n_q);
+      q.head(this->m_n_q) = this->m_q.head(this->m_n_q);
+    }
+
+    /**
+     * \brief Copy the remainder into a polynomial.
+     * \param[out] r Remainder polynomial.
+     */
+    void remainder(Poly<Real, N> &r) const {
+      r.set_order(this->m_n_a);
+      r.head(this->m_n_a) = this->m_a.head(this->m_n_a);
+    }
+
+  };  // class DivideWorkspace
+
+  /**
+   * \brief Divisor with a precomputed inverse.
+   *
+   * This class stores a normalized divisor \f$ b(x) \f$ together with the
+   * power series inverse of its reversed polynomial, so that many dividends
+   * can be reduced by the same divisor with two multiplications each (see \c
+   * divide_inverse(...)) and without repeating the Newton inversion. The
+   * inverse is extended on demand when a dividend of higher order than the
+   * reserved one is divided.
+   * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
+   */
+  template <typename Real, Integer N = Eigen::Dynamic>
+  class Divisor {
+   public:
+    using Vector =
+        typename Poly<Real, N>::Vector; /**< Vector of real numbers. */
+
+   private:
+    Vector m_b_norm;    /**< Normalized divisor. */
+    Vector m_inv;       /**< Inverse of the reversed normalized divisor. */
+    Real m_scale_b{0};  /**< Scaling of the divisor. */
+    Integer m_n_b{0};   /**< Order of the divisor. */
+    Integer m_n_inv{0}; /**< Number of coefficients of the inverse. */
+
+   public:
+    /**
+     * \brief Class constructor for the divisor.
+     */
+    Divisor() {}
 
+    /**
+     * \brief Class constructor for the divisor.
+     * \param[in] p Polynomial to divide by.
+     * \param[in] order Maximum order of the dividends.
+     */
+    explicit Divisor(const Poly<Real, N> &p, Integer order = 0) {
+      this->set(p, order);
+    }
+
+    /**
+     * \brief Set the divisor and invert it.
+     * \param[in] p Polynomial to divide by.
+     * \param[in] order Maximum order of the dividends.
+     */
+    void set(const Poly<Real, N> &p, Integer order = 0) {
+      this->m_n_b = p.order();
+      STURM_ASSERT(this->m_n_b > 0,
+                   "Sturm::Divisor::set(...): divisor is the zero polynomial.");
+      this->m_b_norm  = p.to_eigen();
+      this->m_scale_b = this->m_b_norm.cwiseAbs().maxCoeff();
+      this->m_b_norm /= this->m_scale_b;
       STURM_ASSERT(
-          std::abs(leading_b_norm) > Poly<Real>::EPSILON,
-          "Sturm::Poly::divide(...): leading coefficient of p_2(x) is 0.");
+          std::abs(this->m_b_norm.coeff(this->m_n_b - 1)) >
+              (Poly<Real, N>::EPSILON),
+          "Sturm::Divisor::set(...): leading coefficient of p(x) is 0.");
+      this->m_n_inv = 0;
+      this->reserve(std::max(order, this->m_n_b));
+    }
+
+    /**
+     * \brief Extend the inverse for dividends up to a given order.
+     * \param[in] order Maximum order of the dividends.
+     */
+    void reserve(Integer order) {
+      Integer n_inv{order - this->m_n_b + 1};
+      if (n_inv <= this->m_n_inv) {
+        return;
+      }
+      Vector b_rev(this->m_b_norm.reverse());
+      this->m_inv.conservativeResize(n_inv);
+      Sturm::inverse_series(
+          b_rev.data(), this->m_n_b, this->m_inv.data(), this->m_n_inv, n_inv);
+      this->m_n_inv = n_inv;
+    }
+
+    /**
+     * \brief Get the order of the divisor.
+     * \return The order of the divisor.
+     */
+    Integer order() const {
+      return this->m_n_b;
+    }
 
-      while (d >= 0 && r_degree >= 0) {
-        Real leading_r = {r(r_degree)};
-        Real ratio{leading_r / leading_b_norm};
-        q.coeffRef(d) = ratio;
-        r.segment(d, p_2_norm.degree()).noalias() -=
-            ratio * p_2_norm.head(p_2_norm.degree());
-        r.coeffRef(r_degree) = 0;
-        --r_degree;
-        --d;
+    /**
+     * \brief Divide a polynomial by the divisor.
+     *
+     * Same as \c divide(...), with the quotient and remainder computed from
+     * the precomputed inverse.
+     * \param[in] p Polynomial to divide.
+     * \param[out] q Quotient polynomial.
+     * \param[out] r Remainder polynomial.
+     */
+    void divide(const Poly<Real, N> &p, Poly<Real, N> &q, Poly<Real, N> &r) {
+      Integer n_a{p.order()}, n_b{this->m_n_b};
+      if (n_a < n_b) {
+        // Same convention as divide(...): p(x) = b(x) * (scale_a/scale_b) +
+        // r(x)
+        Real scale_a{n_a > 0 ? p.cwiseAbs().maxCoeff() : Real(0.0)};
+        q.set_order(1);
+        q.coeffRef(0) = scale_a / this->m_scale_b;
+        r.set_order(n_b);
+        r.head(n_a) = p.to_eigen();
+        r.tail(n_b - n_a).setZero();
+        r.head(n_b) -= scale_a * this->m_b_norm;
+      } else {
+        this->reserve(n_a);
+        q.set_order(n_a - n_b + 1);
+        r.set_order(n_b - 1);
+        Sturm::divide_inverse(p.data(),
+                              n_a,
+                              this->m_b_norm.data(),
+                              n_b,
+                              this->m_inv.data(),
+                              q.data(),
+                              r.data());
+        q /= this->m_scale_b;
       }
 
-      // Do not purge remainder: this can be done externally with r.purge(eps);
+      // Do not purge remainder: this can be done externally with purge(eps)
       r.adjust_degree();
     }
 
-    // Scale back polinomials:
-    // - p_1_norm(x) = p_2_norm(x) * q(x) + r(x)
-    // - p_1(x) / scale_p_1 = p_2(x) / scale_p_2 * q(x) + r(x)
-    // - p_1(x) = p_2(x) * (scale_p_1/scale_p_2) * q(x) + scale_p_1*r(x)
-    q *= scale_p_1 / scale_p_2;
-    r *= scale_p_1;
+  };  // class Divisor
+
+  /**
+   * \brief Divide the polynomial.
+   *
+   * Divide the polynomial \f$ p_1(x) \f$ by \f$ p_2(x) \f$ with remainder \f$
+   * r(x) \f$ and quotient \f$ q(x) \f$. The division runs in place in the
+   * given workspace, so that repeated calls do not allocate once the workspace
+   * and the outputs have reached their working size.
+   * \param[in] p_1 Polynomial to divide.
+   * \param[in] p_2 Polynomial to divide by.
+   * \param[out] q Quotient polynomial.
+   * \param[out] r Remainder polynomial.
+   * \param[in,out] ws Workspace for the division.
+   * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
+   */
+  template <typename Real, Integer N>
+  inline void divide(const Poly<Real, N> &p_1,
+                     const Poly<Real, N> &p_2,
+                     Poly<Real, N> &q,
+                     Poly<Real, N> &r,
+                     DivideWorkspace<Real, N> &ws) {
+    ws.load(p_1, p_2);
+    ws.divide();
+    ws.quotient(q);
+    ws.remainder(r);
+  }
+
+  /**
+   * \brief Divide the polynomial.
+   *
+   * Divide the polynomial \f$ p_1(x) \f$ by \f$ p_2(x) \f$ with remainder \f$
+   * r(x) \f$ and quotient \f$ q(x) \f$.
+   * \param[in] p_1 Polynomial to divide.
+   * \param[in] p_2 Polynomial to divide by.
+   * \param[out] q Quotient polynomial.
+   * \param[out] r Remainder polynomial.
+   * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
+   */
+  template <typename Real, Integer N>
+  inline void divide(const Poly<Real, N> &p_1,
+                     const Poly<Real, N> &p_2,
+                     Poly<Real, N> &q,
+                     Poly<Real, N> &r) {
+    DivideWorkspace<Real, N> ws;
+    Sturm::divide(p_1, p_2, q, r, ws);
+  }
+
+  /**
+   * \brief Divide the polynomial.
+   *
+   * Divide the polynomial \f$ p_1(x) \f$ by a divisor with a precomputed
+   * inverse, with remainder \f$ r(x) \f$ and quotient \f$ q(x) \f$.
+   * \param[in] p_1 Polynomial to divide.
+   * \param[in,out] p_2 Divisor to divide by.
+   * \param[out] q Quotient polynomial.
+   * \param[out] r Remainder polynomial.
+   * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
+   */
+  template <typename Real, Integer N>
+  inline void divide(const Poly<Real, N> &p_1,
+                     Divisor<Real, N> &p_2,
+                     Poly<Real, N> &q,
+                     Poly<Real, N> &r) {
+    p_2.divide(p_1, q, r);
   }
 
   /**
    * \brief Compute the greatest common divisor of two polynomials.
+   *
+   * The Euclidean algorithm runs iteratively in the given workspace, so that
+   * repeated calls do not allocate once the workspace and the output have
+   * reached their working size.
    * \param[in] p_1 First polynomial.
    * \param[in] p_2 Second polynomial.
    * \param[out] gcd Greatest common divisor polynomial.
+   * \param[in,out] ws Workspace for the divisions.
    * \param[in] eps Epsilon value for purging coefficients.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline void GCD(const Poly<Real> &p_1,
-                  const Poly<Real> &p_2,
-                  Poly<Real> &gcd,
-                  Real eps = Poly<Real>::EPSILON) {
-    if (p_2.order() > 0) {
-      Poly<Real> q, r;
-      Sturm::divide(p_1, p_2, q, r);
-      r.purge(eps);
-      Sturm::GCD(p_2, r, gcd, eps);
-    } else {
-      gcd = p_1;
+  template <typename Real, Integer N>
+  inline void GCD(const Poly<Real, N> &p_1,
+                  const Poly<Real, N> &p_2,
+                  Poly<Real, N> &gcd,
+                  DivideWorkspace<Real, N> &ws,
+                  Real eps = Poly<Real, N>::EPSILON) {
+    ws.load(p_1, p_2);
+    while (ws.divisor_order() > 0) {
+      ws.divide();
+      ws.purge(eps);
+      ws.shift();
     }
+    ws.remainder(gcd);
     gcd.normalize();
   }
 
+  /**
+   * \brief Compute the greatest common divisor of two polynomials.
+   * \param[in] p_1 First polynomial.
+   * \param[in] p_2 Second polynomial.
+   * \param[out] gcd Greatest common divisor polynomial.
+   * \param[in] eps Epsilon value for purging coefficients.
+   * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
+   */
+  template <typename Real, Integer N>
+  inline void GCD(const Poly<Real, N> &p_1,
+                  const Poly<Real, N> &p_2,
+                  Poly<Real, N> &gcd,
+                  Real eps = Poly<Real, N>::EPSILON) {
+    DivideWorkspace<Real, N> ws;
+    Sturm::GCD(p_1, p_2, gcd, ws, eps);
+  }
+
   /**
    * \brief Print the polynomial on an output stream.
    * \param[in] os Output stream.
    * \param[in] p Polynomial.
    * \return The output stream.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomials.
    */
-  template <typename Real>
-  inline std::ostream &operator<<(std::ostream &os, const Poly<Real> &p) {
+  template <typename Real, Integer N>
+  inline std::ostream &operator<<(std::ostream &os, const Poly<Real, N> &p) {
     os << p.to_string();
     return os;
   }
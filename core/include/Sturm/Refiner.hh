@@ -0,0 +1,572 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef INCLUDE_STURM_REFINER_HH
+#define INCLUDE_STURM_REFINER_HH
+
+#include "Sturm.hh"
+
+namespace Sturm {
+
+  /**
+   * \brief Tolerances of the root refiners.
+   *
+   * A bracket \f$ [a, b] \f$ around the root \f$ x \f$ is accepted when its
+   * width is below the largest of the absolute tolerance, the relative
+   * tolerance times \f$ |x| \f$, and the given number of units in the last
+   * place of \f$ x \f$.
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  struct Tolerance {
+    Real absolute{0.0}; /**< Absolute tolerance. */
+    Real relative{0.0}; /**< Relative tolerance. */
+    Integer ulps{4};    /**< Tolerance in units in the last place. */
+
+    /**
+     * \brief Get the tolerance at a given point.
+     * \param[in] x Point at which to compute the tolerance.
+     * \return The tolerance, never below the smallest normal number.
+     */
+    Real operator()(Real x) const {
+      Real abs_x{std::abs(x)};
+      return std::max({this->absolute,
+                       this->relative * abs_x,
+                       static_cast<Real>(this->ulps) *
+                           std::numeric_limits<Real>::epsilon() * abs_x,
+                       std::numeric_limits<Real>::min()});
+    }
+  };
+
+  /**
+   * \brief Safeguarded Newton-bisection root refiner.
+   *
+   * The Newton step is taken when it falls inside the current bracket and
+   * halves the step of two iterations before, otherwise the bracket is
+   * bisected. The function and its derivative are computed in a single pass
+   * by \c evaluate(x, f, Df).
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  class Newton {
+    Tolerance<Real> m_tolerance;   /**< Tolerances. */
+    Integer m_max_iterations{100}; /**< Maximum number of iterations. */
+
+   public:
+    /**
+     * \brief Class constructor for the Newton-bisection refiner.
+     * \param[in] tolerance Tolerances.
+     * \param[in] max_iterations Maximum number of iterations.
+     */
+    explicit Newton(Tolerance<Real> tolerance = {},
+                    Integer max_iterations = 100)
+        : m_tolerance(tolerance), m_max_iterations(max_iterations) {}
+
+    /**
+     * \brief Refine a root in a bracket where the function changes sign.
+     * \param[in] a Lower bound of the bracket.
+     * \param[in] b Upper bound of the bracket.
+     * \param[in] f Function, e.g., a polynomial.
+     * \param[out] x Root.
+     * \return True if the refinement converged.
+     * \tparam Function Type with the member `void evaluate(Real x, Real &f,
+     * Real &Df) const`.
+     */
+    template <typename Function>
+    bool solve(Real a, Real b, const Function &f, Real &x) const {
+      Real fa, fb, fx, Dfx;
+      f.evaluate(a, fa, Dfx);
+      f.evaluate(b, fb, Dfx);
+      if (fa == 0) {
+        x = a;
+        return true;
+      }
+      if (fb == 0) {
+        x = b;
+        return true;
+      }
+      if ((fa > 0) == (fb > 0)) {
+        x = (a + b) / 2;
+        return false;
+      }
+      // Orient the bracket so that f(a) < 0 < f(b)
+      if (fa > 0) {
+        std::swap(a, b);
+      }
+      x = (a + b) / 2;
+      Real dx{std::abs(b - a)}, dx_old{dx};
+      f.evaluate(x, fx, Dfx);
+      for (Integer i{0}; i < this->m_max_iterations; ++i) {
+        if (fx == 0) {
+          return true;
+        }
+        if (fx < 0) {
+          a = x;
+        } else {
+          b = x;
+        }
+        Real y{x - fx / Dfx};
+        bool newton{(y - a) * (y - b) <= 0 && 2 * std::abs(fx) <
+                                                 std::abs(dx_old * Dfx)};
+        dx_old = dx;
+        if (newton) {
+          dx = y - x;
+          x  = y;
+        } else {
+          y  = (a + b) / 2;
+          dx = y - x;
+          x  = y;
+        }
+        if (std::abs(dx) <= this->m_tolerance(x) ||
+            std::abs(b - a) <= this->m_tolerance(x)) {
+          return true;
+        }
+        f.evaluate(x, fx, Dfx);
+      }
+      return false;
+    }
+  };  // class Newton
+
+  /**
+   * \brief Brent's root refiner.
+   *
+   * Inverse quadratic interpolation and secant steps, with a bisection
+   * whenever the interpolation does not shrink the bracket fast enough.
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  class Brent {
+    Tolerance<Real> m_tolerance;   /**< Tolerances. */
+    Integer m_max_iterations{100}; /**< Maximum number of iterations. */
+
+   public:
+    /**
+     * \brief Class constructor for the Brent refiner.
+     * \param[in] tolerance Tolerances.
+     * \param[in] max_iterations Maximum number of iterations.
+     */
+    explicit Brent(Tolerance<Real> tolerance = {},
+                   Integer max_iterations = 100)
+        : m_tolerance(tolerance), m_max_iterations(max_iterations) {}
+
+    /**
+     * \brief Refine a root in a bracket where the function changes sign.
+     * \param[in] a_in Lower bound of the bracket.
+     * \param[in] b_in Upper bound of the bracket.
+     * \param[in] f Function, e.g., a polynomial.
+     * \param[out] x Root.
+     * \return True if the refinement converged.
+     * \tparam Function Type with the member `Real evaluate(Real x) const`.
+     */
+    template <typename Function>
+    bool solve(Real a_in, Real b_in, const Function &f, Real &x) const {
+      Real a{a_in}, b{b_in}, c{b_in};
+      Real fa{f.evaluate(a)}, fb{f.evaluate(b)}, fc{fb};
+      if ((fa > 0 && fb > 0) || (fa < 0 && fb < 0)) {
+        x = (a + b) / 2;
+        return false;
+      }
+      Real d{b - a}, e{d};
+      for (Integer i{0}; i < this->m_max_iterations; ++i) {
+        if ((fb > 0 && fc > 0) || (fb < 0 && fc < 0)) {
+          c  = a;
+          fc = fa;
+          e = d = b - a;
+        }
+        // Keep b as the best approximation
+        if (std::abs(fc) < std::abs(fb)) {
+          a  = b;
+          b  = c;
+          c  = a;
+          fa = fb;
+          fb = fc;
+          fc = fa;
+        }
+        Real tol{this->m_tolerance(b) / 2};
+        Real m{(c - b) / 2};
+        if (std::abs(m) <= tol || fb == 0) {
+          x = b;
+          return true;
+        }
+        if (std::abs(e) >= tol && std::abs(fa) > std::abs(fb)) {
+          Real s{fb / fa}, p, q;
+          if (a == c) {
+            // Secant step
+            p = 2 * m * s;
+            q = 1 - s;
+          } else {
+            // Inverse quadratic interpolation
+            Real r{fb / fc};
+            q = fa / fc;
+            p = s * (2 * m * q * (q - r) - (b - a) * (r - 1));
+            q = (q - 1) * (r - 1) * (s - 1);
+          }
+          if (p > 0) {
+            q = -q;
+          } else {
+            p = -p;
+          }
+          if (2 * p <
+              std::min(3 * m * q - std::abs(tol * q), std::abs(e * q))) {
+            e = d;
+            d = p / q;
+          } else {
+            d = m;
+            e = m;
+          }
+        } else {
+          d = m;
+          e = m;
+        }
+        a  = b;
+        fa = fb;
+        b += std::abs(d) > tol ? d : (m > 0 ? tol : -tol);
+        fb = f.evaluate(b);
+      }
+      x = b;
+      return false;
+    }
+  };  // class Brent
+
+  /**
+   * \brief ITP (interpolate, truncate, project) root refiner.
+   *
+   * The regula falsi point is truncated towards the midpoint and projected
+   * into a neighbourhood of the midpoint, so that the number of iterations is
+   * never larger than the one of the bisection plus \c n_0, while the
+   * convergence is superlinear for smooth functions (Oliveira and Takahashi,
+   * 2020). The defaults are larger than the ones of the paper (\f$ k_1 = 0.2
+   * \f$, \f$ n_0 = 1 \f$): with a steep polynomial the regula falsi point is
+   * poor in the first steps, the slack is used up there, and the remaining
+   * steps are bisections.
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  class ITP {
+    Tolerance<Real> m_tolerance; /**< Tolerances. */
+    Real m_k_1{1.0};             /**< Truncation factor (relative to the
+                                    initial bracket width). */
+    Real m_k_2{2.0};             /**< Truncation exponent. */
+    Integer m_n_0{5};            /**< Slack iterations over the bisection. */
+
+    /**
+     * \brief Get the half-width tolerance on a bracket.
+     * \param[in] a Lower bound of the bracket.
+     * \param[in] b Upper bound of the bracket.
+     * \return The tolerance at the point of the bracket closest to zero.
+     */
+    Real tolerance(Real a, Real b) const {
+      return this->m_tolerance((a > 0) == (b > 0)
+                                   ? std::min(std::abs(a), std::abs(b))
+                                   : Real(0.0)) /
+             2;
+    }
+
+   public:
+    /**
+     * \brief Class constructor for the ITP refiner.
+     * \param[in] tolerance Tolerances.
+     * \param[in] k_1 Truncation factor, scaled by the initial bracket width.
+     * \param[in] k_2 Truncation exponent, in \f$ [1, 1 + \phi) \f$.
+     * \param[in] n_0 Slack iterations over the bisection.
+     */
+    explicit ITP(Tolerance<Real> tolerance = {},
+                 Real k_1                  = 1.0,
+                 Real k_2                  = 2.0,
+                 Integer n_0               = 5)
+        : m_tolerance(tolerance), m_k_1(k_1), m_k_2(k_2), m_n_0(n_0) {}
+
+    /**
+     * \brief Refine a root in a bracket where the function changes sign.
+     * \param[in] a Lower bound of the bracket.
+     * \param[in] b Upper bound of the bracket.
+     * \param[in] f Function, e.g., a polynomial.
+     * \param[out] x Root.
+     * \return True if the refinement converged.
+     * \tparam Function Type with the member `Real evaluate(Real x) const`.
+     */
+    template <typename Function>
+    bool solve(Real a, Real b, const Function &f, Real &x) const {
+      Real fa{f.evaluate(a)}, fb{f.evaluate(b)};
+      if (fa == 0) {
+        x = a;
+        return true;
+      }
+      if (fb == 0) {
+        x = b;
+        return true;
+      }
+      if ((fa > 0) == (fb > 0)) {
+        x = (a + b) / 2;
+        return false;
+      }
+      // Projection radius eps 2^(n_max - k) with n_max = ceil(log2((b - a) /
+      // (2 eps))) + n_0, computed without forming 2^n_max, which overflows for
+      // the tiny tolerances around zero
+      Real eps{this->tolerance(a, b)};
+      Real log_ratio{std::log2(b - a) - std::log2(2 * eps)};
+      Real r_k{(b - a) / 2 *
+               std::ldexp(std::exp2(std::ceil(log_ratio) - log_ratio),
+                          this->m_n_0)};
+      Real k_1{this->m_k_1 / (b - a)};
+      while (b - a > 2 * this->tolerance(a, b)) {
+        Real m{(a + b) / 2};
+        if (!(m > a && m < b)) {
+          break;
+        }
+        // Interpolation
+        Real x_f{(b * fa - a * fb) / (fa - fb)};
+        // Truncation, never below the tolerance, otherwise it is lost in the
+        // rounding once the bracket is small and only one bound moves
+        Real sigma{m > x_f ? Real(1.0) : Real(-1.0)};
+        Real delta{std::max(k_1 * std::pow(b - a, this->m_k_2),
+                            this->tolerance(a, b))};
+        Real x_t{delta <= std::abs(m - x_f) ? x_f + sigma * delta : m};
+        // Projection
+        Real r{r_k - (b - a) / 2};
+        x = std::abs(x_t - m) <= r ? x_t : m - sigma * r;
+        Real fx{f.evaluate(x)};
+        if (fx == 0) {
+          return true;
+        }
+        if ((fx > 0) == (fa > 0)) {
+          a  = x;
+          fa = fx;
+        } else {
+          b  = x;
+          fb = fx;
+        }
+        r_k /= 2;
+      }
+      x = (a + b) / 2;
+      return true;
+    }
+  };  // class ITP
+
+  /**
+   * \brief Quadratic interval refinement of root brackets.
+   *
+   * Abbott's quadratic interval refinement shrinks a bracket \f$ [a, b] \f$
+   * where the function changes sign, rather than converging to a point. The
+   * bracket is split into \f$ N \f$ subintervals, and the one containing the
+   * secant root is tested with (at most) two evaluations at its bounds. If the
+   * sign change is there, the bracket shrinks by a factor \f$ N \f$ and \f$ N
+   * \f$ is squared, so that the convergence is quadratic near a simple root.
+   * Otherwise, \f$ N \f$ goes back to \f$ \sqrt{N} \f$ and a secant-guided
+   * bisection step is taken instead, at the secant root clamped to the middle
+   * half of the bracket. The bracket is certified as far as the signs of the
+   * evaluations are correct, with no assumption on the function. The
+   * bracket is accepted when its width is below the tolerance at its point
+   * closest to zero.
+   * \tparam Real Scalar number type.
+   */
+  template <typename Real>
+  class QIR {
+    Tolerance<Real> m_tolerance;   /**< Tolerances. */
+    Integer m_max_iterations{200}; /**< Maximum number of iterations. */
+
+   public:
+    /**
+     * \brief Class constructor for the quadratic interval refiner.
+     * \param[in] tolerance Tolerances on the width of the brackets.
+     * \param[in] max_iterations Maximum number of iterations.
+     */
+    explicit QIR(Tolerance<Real> tolerance = {}, Integer max_iterations = 200)
+        : m_tolerance(tolerance), m_max_iterations(max_iterations) {}
+
+    /**
+     * \brief Get the tolerances on the width of the brackets.
+     * \return The tolerances.
+     */
+    const Tolerance<Real> &tolerance() const {
+      return this->m_tolerance;
+    }
+
+    /**
+     * \brief Get the tolerance on the width of a bracket.
+     * \param[in] a Lower bound of the bracket.
+     * \param[in] b Upper bound of the bracket.
+     * \return The tolerance at the point of the bracket closest to zero.
+     */
+    Real tolerance(Real a, Real b) const {
+      return this->m_tolerance((a > 0) == (b > 0)
+                                   ? std::min(std::abs(a), std::abs(b))
+                                   : Real(0.0));
+    }
+
+    /**
+     * \brief Shrink a bracket where the function changes sign.
+     *
+     * If a root is hit exactly, the bracket collapses on it.
+     * \param[in,out] a Lower bound of the bracket.
+     * \param[in,out] b Upper bound of the bracket.
+     * \param[in] fa Value of the function at the lower bound.
+     * \param[in] fb Value of the function at the upper bound.
+     * \param[in] f Function, e.g., a polynomial.
+     * \return True if the bracket width is within the tolerance.
+     * \tparam Function Type with the member `Real evaluate(Real x) const`.
+     */
+    template <typename Function>
+    bool bracket(Real &a, Real &b, Real fa, Real fb, const Function &f) const {
+      if (fa == 0) {
+        b = a;
+        return true;
+      }
+      if (fb == 0) {
+        a = b;
+        return true;
+      }
+      if ((fa > 0) == (fb > 0)) {
+        return false;
+      }
+      Real N{4.0};
+      for (Integer i{0}; i < this->m_max_iterations; ++i) {
+        Real w{b - a}, tol{this->tolerance(a, b)};
+        if (w <= tol) {
+          return true;
+        }
+        // Secant root as a fraction of the bracket
+        Real s{fa / (fa - fb)};
+        // Never split below the tolerance, so that the subintervals do not
+        // vanish in the rounding
+        N = std::min(N, std::floor(w / tol));
+        bool success{false};
+        if (N >= 4) {
+          Real h{w / N}, j{std::round(s * N)};
+          // Sign at the bound t of the subinterval closest to the secant root,
+          // and at the bound u of the subinterval on the side of the root
+          Real t{j <= 0 ? a : (j >= N ? b : a + j * h)};
+          Real ft{j <= 0 ? fa : (j >= N ? fb : f.evaluate(t))};
+          if (ft == 0) {
+            a = b = t;
+            return true;
+          }
+          bool right{(ft > 0) == (fa > 0)};
+          Real u{right ? (j + 1 >= N ? b : t + h) : (j - 1 <= 0 ? a : t - h)};
+          Real fu{right ? (j + 1 >= N ? fb : f.evaluate(u))
+                        : (j - 1 <= 0 ? fa : f.evaluate(u))};
+          if (fu == 0) {
+            a = b = u;
+            return true;
+          }
+          // Keep the part of the bracket where the sign changes, whatever
+          // the outcome of the test
+          success = right == ((fu > 0) != (fa > 0));
+          if (success) {
+            a  = right ? t : u;
+            fa = right ? ft : fu;
+            b  = right ? u : t;
+            fb = right ? fu : ft;
+          } else if (right) {
+            a  = u;
+            fa = fu;
+          } else {
+            b  = u;
+            fb = fu;
+          }
+        }
+        if (success) {
+          N *= N;
+          continue;
+        }
+        N = std::max(Real(4.0), std::sqrt(N));
+        // Secant-guided bisection
+        w = b - a;
+        s = std::clamp(fa / (fa - fb), Real(0.25), Real(0.75));
+        Real x{a + s * w};
+        if (!(x > a && x < b)) {
+          return b - a <= this->tolerance(a, b);
+        }
+        Real fx{f.evaluate(x)};
+        if (fx == 0) {
+          a = b = x;
+          return true;
+        }
+        if ((fx > 0) == (fa > 0)) {
+          a  = x;
+          fa = fx;
+        } else {
+          b  = x;
+          fb = fx;
+        }
+      }
+      return b - a <= this->tolerance(a, b);
+    }
+
+    /**
+     * \brief Shrink a bracket where the function changes sign.
+     * \param[in,out] a Lower bound of the bracket.
+     * \param[in,out] b Upper bound of the bracket.
+     * \param[in] f Function, e.g., a polynomial.
+     * \return True if the bracket width is within the tolerance.
+     * \tparam Function Type with the member `Real evaluate(Real x) const`.
+     */
+    template <typename Function>
+    bool bracket(Real &a, Real &b, const Function &f) const {
+      return this->bracket(a, b, f.evaluate(a), f.evaluate(b), f);
+    }
+
+    /**
+     * \brief Refine a root in a bracket where the function changes sign.
+     * \param[in] a Lower bound of the bracket.
+     * \param[in] b Upper bound of the bracket.
+     * \param[in] f Function, e.g., a polynomial.
+     * \param[out] x Root, the midpoint of the final bracket.
+     * \return True if the refinement converged.
+     * \tparam Function Type with the member `Real evaluate(Real x) const`.
+     */
+    template <typename Function>
+    bool solve(Real a, Real b, const Function &f, Real &x) const {
+      bool converged{this->bracket(a, b, f)};
+      x = (a + b) / 2;
+      return converged;
+    }
+  };  // class QIR
+
+  /**
+   * \brief Refine a root in a bracket with a refiner or a lambda function.
+   *
+   * A refiner (\c Newton, \c Brent, \c ITP, \c QIR) is handed the polynomial
+   * itself, so that every evaluation is inlined, while a lambda function is
+   * handed the polynomial wrapped into a \c std::function.
+   * \param[in] solve_function Root solver.
+   * \param[in] a Lower bound of the bracket.
+   * \param[in] b Upper bound of the bracket.
+   * \param[in] p Polynomial.
+   * \param[out] x Root.
+   * \return True if the root solver converged.
+   * \tparam Real Scalar number type.
+   * \tparam Function Polynomial type.
+   * \tparam SolveFunction Refiner with the member `bool solve(Real a, Real b,
+   * const Function &p, Real & x) const`, or lambda function with the signature
+   * `bool(Real a, Real b, std::function<Real(Real)> f, Real & x)`.
+   */
+  template <typename Real, typename Function, typename SolveFunction>
+  inline bool refine_root(SolveFunction &solve_function,
+                          Real a,
+                          Real b,
+                          const Function &p,
+                          Real &x) {
+    if constexpr (requires { solve_function.solve(a, b, p, x); }) {
+      return solve_function.solve(a, b, p, x);
+    } else {
+      return solve_function(
+          a,
+          b,
+          std::function<Real(Real x)>([&p](Real y) { return p.evaluate(y); }),
+          x);
+    }
+  }
+
+}  // namespace Sturm
+
+#endif  // INCLUDE_STURM_REFINER_HH
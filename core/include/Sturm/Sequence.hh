@@ -17,6 +17,9 @@
 
 #include "Sturm.hh"
 #include "Sturm/Poly.hh"
+#include "Sturm/Refiner.hh"
+#include "Sturm/StaticVector.hh"
+#include "Sturm/ThreadPool.hh"
 
 namespace Sturm {
 
@@ -26,14 +29,65 @@ namespace Sturm {
    * This class implements the Sturm sequence for a given polynomial \f$ p(x)
    * \f$. Such sequence is a sequence of polynomials \f$ p_0(x), p_1(x), \ldots,
    * p_n(x) \f$ and allows to compute the number roots in a given interval \f$
-   * [a, b] \f$.
+   * [a, b] \f$. When the maximum degree is given at compile time, the
+   * sequence, the intervals and all the temporaries are stored in
+   * fixed-capacity containers, so that building the sequence and separating
+   * the roots do not allocate on the heap. The \c const queries only read the
+   * sequence and write into a caller-owned \c Result, so that a sequence
+   * built once can serve concurrent queries, each thread with its own
+   * result.
    * \tparam Real Scalar number type.
+   * \tparam MaxDegree Maximum degree of the polynomial (\c Eigen::Dynamic for
+   * no limit).
    */
-  template <typename Real>
+  template <typename Real, Integer MaxDegree = Eigen::Dynamic>
   class Sequence {
    public:
-    using Vector =
-        Eigen::Vector<Real, Eigen::Dynamic>; /**< Vector of real numbers. */
+    constexpr static const Integer LANES{
+      8}; /**< Polynomials evaluated together in the packed layout. */
+    constexpr static const Integer MAX_LENGTH{
+      MaxDegree == Eigen::Dynamic
+          ? Eigen::Dynamic
+          : MaxDegree + 1}; /**< Maximum length of the sequence. */
+    constexpr static const Integer MAX_GROUPS{
+      MaxDegree == Eigen::Dynamic
+          ? Eigen::Dynamic
+          : (MAX_LENGTH + LANES - 1) / LANES}; /**< Maximum lane groups. */
+    constexpr static const Integer MAX_INTERVALS{
+      MaxDegree == Eigen::Dynamic
+          ? Eigen::Dynamic
+          : 2 * MAX_LENGTH}; /**< Maximum number of intervals. */
+    constexpr static const Real CLUSTER_WIDTH{
+      8.0}; /**< Width of the clusters, relative to the accuracy of a
+                multiple root. */
+    constexpr static const Integer CLUSTER_ORDER{
+      3}; /**< Largest multiplicity setting the width of the clusters. */
+    constexpr static const Integer PARALLEL_ROOTS{
+      4}; /**< Minimum roots of an interval queued as a parallel task. */
+    constexpr static const Integer A_ON_ROOT{
+      1}; /**< Flag of a bracket whose lower bound is a root. */
+    constexpr static const Integer B_ON_ROOT{
+      2}; /**< Flag of a bracket whose upper bound is a root. */
+    constexpr static const Integer CLUSTER{
+      4}; /**< Flag of a bracket holding a cluster of roots. */
+    constexpr static const Integer UNRESOLVED{
+      8}; /**< Flag of a bracket left unresolved by a limit. */
+    constexpr static const Integer MAX_PACKED{
+      MaxDegree == Eigen::Dynamic
+          ? Eigen::Dynamic
+          : MAX_GROUPS * LANES}; /**< Maximum packed polynomials. */
+    using Vector = Eigen::Matrix<Real,
+                                 Eigen::Dynamic,
+                                 1,
+                                 Eigen::ColMajor,
+                                 MAX_INTERVALS,
+                                 1>; /**< Vector of real numbers. */
+    using Packed = Eigen::Matrix<Real,
+                                 Eigen::Dynamic,
+                                 Eigen::Dynamic,
+                                 Eigen::RowMajor,
+                                 Poly<Real, MaxDegree>::MAX_ORDER,
+                                 MAX_PACKED>; /**< Packed coefficients. */
     using Interval = struct Interval {
       Real a;         /**< Lower bound of the interval. */
       Real b;         /**< Upper bound of the interval. */
@@ -41,15 +95,839 @@ namespace Sturm {
       Integer vb;     /**< Sign of the polynomial at the upper bound. */
       bool a_on_root; /**< True if the lower bound is a root. */
       bool b_on_root; /**< True if the upper bound is a root. */
+      Integer multiplicity{1}; /**< Number of roots, complex ones included,
+                                  greater than one for a cluster. */
+      Integer depth{0};        /**< Bisections leading to the interval. */
+      bool unresolved{false}; /**< True if a limit of the separation stopped
+                                 the bisection, the interval holds \f$ |v_a -
+                                 v_b| \f$ roots. */
     }; /**< Interval structure. */
+    using Statistics = struct Statistics {
+      Integer evaluations{0}; /**< Evaluations of the sequence at a point. */
+      Integer filter_tests{0}; /**< Descartes tests of the filter. */
+      Integer filtered{0}; /**< Evaluations saved by the filter. */
+      Integer cluster_tests{0}; /**< Pellet tests of the cluster detection. */
+      Integer unresolved{0}; /**< Intervals left unresolved by a limit. */
+      Integer escalations{0}; /**< Signs escalated by the certified mode. */
+
+      /**
+       * \brief Accumulate the statistics of a task.
+       * \param[in] s Statistics of the task.
+       * \return The accumulated statistics.
+       */
+      Statistics &operator+=(const Statistics &s) {
+        this->evaluations += s.evaluations;
+        this->filter_tests += s.filter_tests;
+        this->filtered += s.filtered;
+        this->cluster_tests += s.cluster_tests;
+        this->unresolved += s.unresolved;
+        this->escalations += s.escalations;
+        return *this;
+      }
+    }; /**< Statistics of the last root separation. */
+    using BisectWorkspace = struct BisectWorkspace {
+      Poly<Real, MaxDegree> q; /**< Transformed polynomial. */
+      Poly<Real, MaxDegree> m; /**< Bound on its rounding errors. */
+    }; /**< Workspace of the Descartes filter and of the cluster detection. */
+    using Clock   = std::chrono::steady_clock; /**< Clock of the deadline. */
+    using Options = struct Options {
+      Integer max_evaluations{
+        std::numeric_limits<Integer>::max()}; /**< Maximum evaluations of the
+                                                 sequence at a point. */
+      Integer max_depth{
+        std::numeric_limits<Integer>::max()}; /**< Maximum bisections leading
+                                                 to an interval. */
+      Clock::time_point deadline{
+        Clock::time_point::max()}; /**< Wall-clock deadline. */
+    }; /**< Limits of the root separation. */
+    using Result = struct Result {
+      Container<Interval, MAX_INTERVALS> intervals; /**< Computed intervals. */
+      Vector roots; /**< Roots computed in the intervals. */
+      Real a{0.0};  /**< Lower bound of the interval containing the roots. */
+      Real b{0.0};  /**< Upper bound of the interval containing the roots. */
+      Statistics statistics; /**< Statistics of the root separation. */
+      Container<Interval, MAX_INTERVALS>
+          stack;                 /**< Work list of the bisection. */
+      BisectWorkspace workspace; /**< Workspace of the bisection. */
+    }; /**< Result of a root separation, with its buffers. */
+    using Brackets = struct Brackets {
+      Container<Real, MAX_INTERVALS> a; /**< Lower bounds of the intervals. */
+      Container<Real, MAX_INTERVALS> b; /**< Upper bounds of the intervals. */
+      Container<Integer, MAX_INTERVALS>
+          flags; /**< Flags of the intervals, a combination of \c A_ON_ROOT,
+                    \c B_ON_ROOT, \c CLUSTER and \c UNRESOLVED. */
+      Statistics statistics; /**< Statistics of the root separation. */
+      Container<Interval, MAX_INTERVALS>
+          stack;                 /**< Work list of the bisection. */
+      BisectWorkspace workspace; /**< Workspace of the bisection. */
+    }; /**< Intervals of a root separation as separate arrays, with their
+          buffers. */
 
    private:
-    std::vector<Poly<Real>> m_sequence; /**< Sturm sequence. */
-    std::vector<Interval> m_intervals;  /**< Computed intervals. */
-    Real m_a{0.0}; /**< Lower bound of the interval containing the roots. */
-    Real m_b{0.0}; /**< Upper bound of the interval containing the roots. */
+    Container<Poly<Real, MaxDegree>, MAX_LENGTH>
+        m_sequence;      /**< Sturm sequence (buffers kept across builds). */
+    Integer m_length{0}; /**< Length of the Sturm sequence. */
+    DivideWorkspace<Real, MaxDegree>
+        m_workspace; /**< Workspace for the divisions. */
+    Packed m_packed; /**< Packed sequence, the \f$ (k, i) \f$ entry is the
+                        \f$ k \f$-th coefficient of \f$ p_i(x) \f$. */
+    Container<Integer, MAX_GROUPS>
+        m_packed_order; /**< Maximum order within each group of lanes. */
+    Result m_result; /**< Result of the last root separation. */
+    bool m_filter{false}; /**< True if the Descartes filter is enabled. */
+    bool m_clusters{false}; /**< True if the cluster detection is enabled. */
+    bool m_certified{false}; /**< True if the signs are certified. */
+    Evaluation m_evaluation{
+      Evaluation::NATIVE}; /**< Evaluation strategy of the signs. */
+    std::array<Real, CLUSTER_ORDER + 1>
+        m_cluster_width{}; /**< Width of the clusters of \f$ k \f$ roots,
+                              relative to \f$ \max(1, |a|, |b|) \f$. */
+
+    /**
+     * \brief Access the \f$ i \f$-th polynomial buffer of the sequence,
+     * creating it if needed.
+     * \param[in] i Index of the polynomial.
+     * \return Reference to the \f$ i \f$-th polynomial buffer.
+     */
+    Poly<Real, MaxDegree> &polynomial(Integer i) {
+      while (static_cast<Integer>(this->m_sequence.size()) <= i) {
+        this->m_sequence.emplace_back();
+      }
+      return this->m_sequence[i];
+    }
+
+    /**
+     * \brief Account for the sign of \f$ p_i(x) \f$ in the sign variations.
+     * \param[in] v Value of \f$ p_i(x) \f$.
+     * \param[in] i Index of the polynomial in the sequence.
+     * \param[in,out] last_sign Last nonzero sign of the sequence.
+     * \param[in,out] sign_var Number of sign variations.
+     * \param[in,out] on_root Set to true if \f$ p_0(x) \f$ is zero.
+     */
+    static void add_sign(Real v,
+                         Integer i,
+                         Integer &last_sign,
+                         Integer &sign_var,
+                         bool &on_root) {
+      if (v > 0) {
+        if (last_sign == -1) {
+          ++sign_var;
+        }
+        last_sign = 1;
+      } else if (v < 0) {
+        if (last_sign == 1) {
+          ++sign_var;
+        }
+        last_sign = -1;
+      } else if (i == 0) {
+        on_root = true;
+      }
+    }
+
+    /**
+     * \brief Compute the sign variations of the stored Sturm sequence at \f$
+     * x \f$ with the evaluation strategy of the sequence.
+     *
+     * The polynomials are evaluated one by one by \c Poly::evaluate(x,
+     * evaluation), since the compensated and double-word schemes are not
+     * packed.
+     * \param[in] x Point at which to compute the sign variations.
+     * \param[out] on_root True if \f$ x \f$ is a root of \f$ p_0(x) \f$.
+     * \return The number of sign variations.
+     */
+    Integer evaluated_sign_variations(Real x, bool &on_root) const {
+      Integer sign_var{0};
+      Integer last_sign{0};
+      on_root = false;
+      for (Integer i{0}; i < this->length(); ++i) {
+        add_sign(this->m_sequence[i].evaluate(x, this->m_evaluation),
+                 i,
+                 last_sign,
+                 sign_var,
+                 on_root);
+      }
+      return sign_var;
+    }
+
+    /**
+     * \brief Compute the certified sign variations of the stored Sturm
+     * sequence at \f$ x \f$.
+     *
+     * The packed sequence is evaluated as in \c sign_variations(x, on_root),
+     * together with the running error bound of Horner's scheme (see Higham,
+     * "Accuracy and Stability of Numerical Algorithms", 2002, Sec. 5.1),
+     * taken with twice the unit roundoff as a safety margin. A sign is only
+     * trusted if the value is larger than its bound. The few uncertain ones
+     * are escalated to \c Poly::evaluate_compensated(...), and a value still
+     * within its bound is skipped, which gives the right count whatever the
+     * true sign of \f$ p_i(x) \f$, \f$ i > 0 \f$, since its neighbours
+     * have opposite signs there. The sign of \f$ p_0(x) \f$ does change the
+     * count, so that an uncertain one is flagged instead, and only an exact
+     * zero of the compensated value sets the root flag.
+     * \param[in] x Point at which to compute the sign variations.
+     * \param[out] on_root True if \f$ x \f$ is a root of \f$ p_0(x) \f$.
+     * \param[out] uncertain True if the sign of \f$ p_0(x) \f$ is unknown.
+     * \param[in,out] escalations Number of escalated signs to be updated.
+     * \return The number of sign variations.
+     */
+    Integer certified_sign_variations(Real x,
+                                      bool &on_root,
+                                      bool &uncertain,
+                                      Integer &escalations) const {
+      using Lanes = Eigen::Array<Real, 1, LANES>;
+      constexpr Real EPSILON{std::numeric_limits<Real>::epsilon()};
+      Real abs_x{std::abs(x)};
+      Integer sign_var{0};
+      Integer last_sign{0};
+      Integer n_poly{this->length()};
+      on_root   = false;
+      uncertain = false;
+      for (Integer i{0}, g{0}; i < n_poly; ++g) {
+        Integer n{this->m_packed_order[g] - 1};
+        Lanes v{this->m_packed.template block<1, LANES>(n, g * LANES)};
+        Lanes mu{v.abs() / 2};
+        while (n-- > 0) {
+          v = v * x +
+              this->m_packed.template block<1, LANES>(n, g * LANES).array();
+          mu = mu * abs_x + v.abs();
+        }
+        Lanes bound{EPSILON * (2 * mu - v.abs())};
+        for (Integer l{0}; l < LANES && i < n_poly; ++l, ++i) {
+          Real v_l{v.coeff(l)};
+          if (std::abs(v_l) <= bound.coeff(l) && bound.coeff(l) > 0) {
+            ++escalations;
+            Real error;
+            v_l = this->m_sequence[i].evaluate_compensated(x, error);
+            if (std::abs(v_l) <= error) {
+              if (i == 0 && v_l != 0) {
+                uncertain = true;
+                continue;
+              }
+              v_l = 0;
+            }
+          }
+          add_sign(v_l, i, last_sign, sign_var, on_root);
+        }
+      }
+      return sign_var;
+    }
+
+    /**
+     * \brief Compute the sign variations of the stored Sturm sequence at \f$
+     * x \f$ for the root separation.
+     *
+     * Same as \c sign_variations(x, on_root), but the evaluation and the
+     * escalations of the certified mode are counted in the statistics.
+     * \param[in] x Point at which to compute the sign variations.
+     * \param[out] on_root True if \f$ x \f$ is a root of \f$ p_0(x) \f$.
+     * \param[out] uncertain True if the certified mode cannot tell the sign
+     * of \f$ p_0(x) \f$, see \c certified_sign_variations(...).
+     * \param[in,out] stats Statistics to be updated.
+     * \return The number of sign variations.
+     */
+    Integer sign_variations(Real x,
+                            bool &on_root,
+                            bool &uncertain,
+                            Statistics &stats) const {
+      ++stats.evaluations;
+      if (this->m_certified) {
+        return this->certified_sign_variations(
+            x, on_root, uncertain, stats.escalations);
+      }
+      uncertain = false;
+      return this->sign_variations(x, on_root);
+    }
+
+    /**
+     * \brief Initialize the separation of the roots in \f$ [a, b] \f$.
+     *
+     * Store the interval bounds and compute the sign variations at the bounds.
+     * If the interval contains at most one root, the resulting intervals are
+     * stored and no bisection is needed.
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[out] I_0 Initial interval.
+     * \param[out] result Result of the separation.
+     * \return True if the separation is already complete.
+     */
+    bool separate_bounds(Real a_in,
+                         Real b_in,
+                         Interval &I_0,
+                         Result &result) const {
+      result.intervals.clear();
+      result.intervals.reserve(this->m_length);
+      result.statistics = Statistics();
+
+      Interval I_1;
+      result.a = I_0.a = a_in;
+      result.b = I_0.b = b_in;
+
+      // A bound where the sign of p_0 is uncertain is not a root
+      Statistics &stats{result.statistics};
+      bool uncertain;
+      I_0.va = this->sign_variations(I_0.a, I_0.a_on_root, uncertain, stats);
+      I_0.vb = this->sign_variations(I_0.b, I_0.b_on_root, uncertain, stats);
+
+      Integer n_roots{std::abs(I_0.va - I_0.vb)};
+
+      if (n_roots > 1 || (n_roots == 1 && I_0.a_on_root && !I_0.b_on_root)) {
+        return false;
+      }
+      if (n_roots == 1 && !I_0.a_on_root && !I_0.b_on_root) {
+        result.intervals.push_back(I_0);
+      }
+      if (I_0.a_on_root) {
+        I_1.a = I_1.b = I_0.a;
+        I_1.va = I_1.vb = I_0.va;
+        I_1.a_on_root = I_1.b_on_root = true;
+        result.intervals.push_back(I_1);
+      }
+      if (I_0.b_on_root && I_0.b != I_0.a) {
+        I_1.a = I_1.b = I_0.b;
+        I_1.va = I_1.vb = I_0.vb;
+        I_1.a_on_root = I_1.b_on_root = true;
+        result.intervals.push_back(I_1);
+      }
+      return true;
+    }
+
+    /**
+     * \brief Compute the sign variations at the midpoint of an interval from
+     * the roots in its halves.
+     *
+     * The number of roots in the interval is already known from the sign
+     * variations at its bounds, what the bisection needs is the number of
+     * roots in each half. This is bounded by Descartes' rule of signs on the
+     * Mobius transform of \f$ p_0(x) \f$ (see \c Poly::mobius(...)), which
+     * only involves the first polynomial of the sequence. If a half has no
+     * root or a single one, the sign variations at the midpoint follow
+     * without evaluating the sequence there. The bound is only trusted if no
+     * coefficient of the transformed polynomial is at the level of the
+     * rounding errors, and if its parity matches the signs of \f$ p_0(x)
+     * \f$ at the bounds of the half. Otherwise, the sequence is evaluated.
+     * \param[in] I_0 Interval to be bisected.
+     * \param[in] c Midpoint of the interval.
+     * \param[out] vc Sign variations at the midpoint.
+     * \param[in,out] ws Workspace of the filter.
+     * \param[in,out] stats Statistics to be updated.
+     * \return True if the sign variations at the midpoint were found.
+     */
+    bool descartes_filter(const Interval &I_0,
+                          Real c,
+                          Integer &vc,
+                          BisectWorkspace &ws,
+                          Statistics &stats) const {
+      if (I_0.a_on_root || I_0.b_on_root) {
+        return false;
+      }
+      const Poly<Real, MaxDegree> &p{this->m_sequence[0]};
+      Real p_a{p.evaluate(I_0.a)}, p_b{p.evaluate(I_0.b)}, p_c{p.evaluate(c)};
+      if (p_a == 0 || p_b == 0 || p_c == 0) {
+        return false;
+      }
+      // Roots in (x_0, x_1), or -1 if the bound is not trusted
+      Poly<Real, MaxDegree> &q{ws.q}, &m{ws.m};
+      auto roots = [&p, &q, &m, &stats](Real x_0,
+                                        Real x_1,
+                                        Real p_0,
+                                        Real p_1) {
+        ++stats.filter_tests;
+        p.mobius(x_0, x_1, q, m);
+        // A coefficient within its rounding error has no certain sign
+        Real tolerance{4 * static_cast<Real>(q.order()) *
+                       std::numeric_limits<Real>::epsilon()};
+        if ((q.cwiseAbs().array() <= tolerance * m.array()).any()) {
+          return Integer(-1);
+        }
+        Integer n_roots{q.sign_variations()};
+        bool sign_change{(p_0 > 0) != (p_1 > 0)};
+        return n_roots <= 1 && (n_roots == 1) == sign_change ? n_roots
+                                                             : Integer(-1);
+      };
+      Integer n_roots{roots(I_0.a, c, p_a, p_c)};
+      if (n_roots >= 0) {
+        vc = I_0.va - n_roots;
+      } else if ((n_roots = roots(c, I_0.b, p_c, p_b)) >= 0) {
+        vc = I_0.vb + n_roots;
+      } else {
+        return false;
+      }
+      if (vc < std::min(I_0.va, I_0.vb) || vc > std::max(I_0.va, I_0.vb)) {
+        return false;
+      }
+      ++stats.filtered;
+      return true;
+    }
+
+    /**
+     * \brief Check if an interval holds a cluster of roots.
+     *
+     * The roots of multiplicity \f$ k \f$ of a polynomial with rounded
+     * coefficients are only defined up to about \f$ (n \epsilon)^{1/k} \f$,
+     * and the sign variations of the sequence are noise at that scale, so
+     * that the bisection would go on down to the machine precision and emit
+     * misleading single roots. The test is only tried once the interval with
+     * \f$ k \f$ roots is narrower than \f$ w = \f$ \c CLUSTER_WIDTH \f$ (n
+     * \epsilon)^{1/k} \max(1, |a|, |b|) \f$, with \f$ k \f$ capped to \c
+     * CLUSTER_ORDER, and the bisection at its midpoint \f$ c \f$ has failed,
+     * i.e., \f$ p_0(c) \f$ is within the running error bound of Horner's
+     * scheme, so that its sign is unknown, or the sign variations at \f$ c
+     * \f$ do not fit those at the bounds. The roots that the sequence can
+     * still separate are then never lumped together. Pellet's test (see \c
+     * Poly::pellet(...)) is tried on the disc of radius \f$ w/2 \f$ centered
+     * at the midpoint, which holds the interval and keeps the test clear of
+     * the noise. If it proves at least \f$ k \f$ roots there, and the
+     * sequence finds no other real root on the diameter of the disc, the
+     * interval is taken as a cluster with the number of roots in the disc.
+     * \param[in,out] I_0 Interval, whose multiplicity is set on a cluster.
+     * \param[in] n_roots Number of real roots in the interval.
+     * \param[in] c Midpoint of the interval.
+     * \param[in] vc Sign variations at the midpoint.
+     * \param[in] c_on_root True if the midpoint is a root of \f$ p_0(x) \f$.
+     * \param[in,out] ws Workspace of the test.
+     * \param[in,out] stats Statistics to be updated.
+     * \return True if the interval holds a cluster.
+     */
+    bool detect_cluster(Interval &I_0,
+                        Integer n_roots,
+                        Real c,
+                        Integer vc,
+                        bool c_on_root,
+                        BisectWorkspace &ws,
+                        Statistics &stats) const {
+      if (I_0.a_on_root || I_0.b_on_root) {
+        return false;
+      }
+      const Poly<Real, MaxDegree> &p{this->m_sequence[0]};
+      Real scale{std::max({Real(1.0), std::abs(I_0.a), std::abs(I_0.b)})};
+      Real width{scale *
+                 this->m_cluster_width[std::min(n_roots, CLUSTER_ORDER)]};
+      if (I_0.b - I_0.a > width) {
+        return false;
+      }
+      // Only if the bisection at the midpoint fails
+      Real p_c{p.coeff(p.order() - 1)}, mu{std::abs(p_c) / 2};
+      for (Integer i{p.order() - 2}; i >= 0; --i) {
+        p_c = p_c * c + p.coeff(i);
+        mu  = mu * std::abs(c) + std::abs(p_c);
+      }
+      bool fits{vc >= std::min(I_0.va, I_0.vb) &&
+                vc <= std::max(I_0.va, I_0.vb)};
+      if (!c_on_root && fits &&
+          std::abs(p_c) > std::numeric_limits<Real>::epsilon() *
+                              (2 * mu - std::abs(p_c))) {
+        return false;
+      }
+      Real a{c - width / 2}, b{c + width / 2};
+      ++stats.cluster_tests;
+      Integer k{p.pellet(a, b, ws.q, ws.m)};
+      if (k < n_roots) {
+        return false;
+      }
+      bool a_on_root, b_on_root, a_uncertain, b_uncertain;
+      Integer va{this->sign_variations(a, a_on_root, a_uncertain, stats)};
+      Integer vb{this->sign_variations(b, b_on_root, b_uncertain, stats)};
+      if (a_on_root || b_on_root || a_uncertain || b_uncertain ||
+          std::abs(va - vb) != n_roots) {
+        return false;
+      }
+      I_0.multiplicity = k;
+      return true;
+    }
+
+    /**
+     * \brief Check if a limit of the root separation is reached.
+     *
+     * The clock is only read if a deadline is set.
+     * \param[in] options Limits of the separation.
+     * \param[in] I Interval to be bisected.
+     * \param[in] evaluations Evaluations of the sequence so far.
+     * \return True if the interval must not be bisected.
+     */
+    static bool limit_reached(const Options &options,
+                              const Interval &I,
+                              Integer evaluations) {
+      return evaluations >= options.max_evaluations ||
+             I.depth >= options.max_depth ||
+             (options.deadline != Clock::time_point::max() &&
+              Clock::now() >= options.deadline);
+    }
+
+    /**
+     * \brief Process an interval of the root separation.
+     *
+     * If the interval contains at most one root, it is passed to the output.
+     * Otherwise, it is bisected and the halves containing roots are passed to
+     * the work list. If the cluster detection is enabled, the intervals with
+     * several roots are checked with \c detect_cluster(...) once the sign
+     * variations at the midpoint are known, and the clusters are passed to the
+     * output. If the Descartes filter is enabled, the sign variations at the
+     * midpoint are first sought with \c descartes_filter(...). An interval
+     * with several roots that hits a limit of the separation is passed to the
+     * output as unresolved.
+     * \param[in] I_0 Interval to process.
+     * \param[in] push Function receiving the intervals to be processed.
+     * \param[in] emit Function receiving the intervals with a single root.
+     * \param[in] stop Function checking the limits of the separation.
+     * \param[in,out] stats Statistics to be updated.
+     * \param[in,out] ws Workspace of the Descartes filter and of the cluster
+     * detection.
+     * \tparam Push Callable with the signature `void(const Interval &)`.
+     * \tparam Emit Callable with the signature `void(const Interval &)`.
+     * \tparam Stop Callable with the signature `bool(const Interval &)`.
+     */
+    template <typename Push, typename Emit, typename Stop>
+    void bisect(Interval I_0,
+                Push &&push,
+                Emit &&emit,
+                Stop &&stop,
+                Statistics &stats,
+                BisectWorkspace &ws) const {
+      Interval I_1;
+      I_1.depth = I_0.depth + 1;
+      // Check if the interval has a single root. A root at the lower bound is
+      // not counted in (a, b], so that the interval is bisected as if it had
+      // two roots
+      Integer n_roots{std::abs(I_0.va - I_0.vb)};
+      bool split_a{n_roots == 1 && I_0.a_on_root && I_0.b != I_0.a};
+      if (n_roots <= 1 && !split_a) {
+        if (I_0.a_on_root) {
+          I_0.b         = I_0.a;
+          I_0.vb        = I_0.va;
+          I_0.b_on_root = true;
+          emit(I_0);
+        } else if (I_0.b_on_root) {
+          I_0.a         = I_0.b;
+          I_0.va        = I_0.vb;
+          I_0.a_on_root = true;
+          emit(I_0);
+        } else if (n_roots == 1) {
+          emit(I_0);
+        }
+      } else if (stop(I_0)) {
+        I_0.unresolved = true;
+        ++stats.unresolved;
+        emit(I_0);
+      } else if (std::abs(I_0.b - I_0.a) <=
+                 static_cast<Real>(10.0) *
+                     std::numeric_limits<Real>::epsilon() *
+                     std::max(static_cast<Real>(1.0),
+                              std::max(std::abs(I_0.b), std::abs(I_0.a)))) {
+        I_1.a = I_1.b = I_0.a;
+        I_1.va = I_1.vb = 0;
+        I_1.a_on_root = I_1.b_on_root = true;
+        push(I_1);
+      } else {
+        Real c{(I_0.a + I_0.b) / static_cast<Real>(2.0)};
+        bool c_on_root{false}, c_uncertain{false};
+        Integer vc;
+        if (!this->m_filter ||
+            !this->descartes_filter(I_0, c, vc, ws, stats)) {
+          vc = this->sign_variations(c, c_on_root, c_uncertain, stats);
+        }
+        if (this->m_clusters && !split_a &&
+            this->detect_cluster(I_0, n_roots, c, vc, c_on_root, ws, stats)) {
+          emit(I_0);
+          return;
+        }
+        // A point where the certified sign of p_0 is unknown does not split
+        // the interval, hence the bisection moves to the nearby points, and
+        // gives up on the interval if their signs are unknown as well
+        Real w{I_0.b - I_0.a};
+        for (Real t : {-0.125, 0.125, -0.25, 0.25}) {
+          if (!c_uncertain) {
+            break;
+          }
+          c  = (I_0.a + I_0.b) / static_cast<Real>(2.0) + t * w;
+          vc = this->sign_variations(c, c_on_root, c_uncertain, stats);
+        }
+        if (c_uncertain) {
+          I_0.unresolved = true;
+          ++stats.unresolved;
+          emit(I_0);
+          return;
+        }
+        // Check the interval [a, c]
+        if (I_0.va != vc || c_on_root || I_0.a_on_root) {
+          if (c < I_0.b) {  // Check if it is a true reduction
+            I_1.a         = I_0.a;
+            I_1.va        = I_0.va;
+            I_1.a_on_root = I_0.a_on_root;
+            I_1.b         = c;
+            I_1.vb        = vc;
+            I_1.b_on_root = c_on_root;
+            push(I_1);
+          } else if (c_on_root) {
+            I_1.a = I_1.b = c;
+            I_1.a_on_root = I_1.b_on_root = true;
+            I_1.va = I_1.vb = 0;
+            push(I_1);
+          } else if (I_0.a_on_root) {
+            I_1.a = I_1.b = I_0.a;
+            I_1.a_on_root = I_1.b_on_root = true;
+            I_1.va = I_1.vb = 0;
+            push(I_1);
+          }
+        }
+        // Check the interval [c, b]
+        if (I_0.vb != vc || I_0.b_on_root) {
+          if (c > I_0.a) {
+            // A root at the midpoint is already in the interval [a, c]
+            I_1.a         = c;
+            I_1.va        = vc;
+            I_1.a_on_root = false;
+            I_1.b         = I_0.b;
+            I_1.vb        = I_0.vb;
+            I_1.b_on_root = I_0.b_on_root;
+            push(I_1);
+          } else if (I_0.b_on_root) {
+            I_1.a = I_1.b = I_0.b;
+            I_1.a_on_root = I_1.b_on_root = true;
+            I_1.va = I_1.vb = 0;
+            push(I_1);
+          }
+        }
+      }
+    }
+
+    /**
+     * \brief Start a root separation in increasing order.
+     *
+     * The sequence is evaluated at the bounds, and the work list of a
+     * depth-first bisection is filled with the intervals of \c
+     * separate_bounds(...), the leftmost one last.
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[out] stack Work list of the bisection.
+     * \param[in,out] stats Statistics to be updated.
+     */
+    void start_ordered(Real a_in,
+                       Real b_in,
+                       Container<Interval, MAX_INTERVALS> &stack,
+                       Statistics &stats) const {
+      Interval I_0, I_1;
+      I_0.a  = a_in;
+      I_0.b  = b_in;
+      bool uncertain;
+      I_0.va = this->sign_variations(I_0.a, I_0.a_on_root, uncertain, stats);
+      I_0.vb = this->sign_variations(I_0.b, I_0.b_on_root, uncertain, stats);
+      stack.clear();
+      stack.reserve(this->m_length);
+      Integer n_roots{std::abs(I_0.va - I_0.vb)};
+      if (n_roots > 1 || (n_roots == 1 && I_0.a_on_root && !I_0.b_on_root)) {
+        stack.push_back(I_0);
+        return;
+      }
+      I_1.a_on_root = I_1.b_on_root = true;
+      if (I_0.b_on_root && I_0.b != I_0.a) {
+        I_1.a = I_1.b = I_0.b;
+        I_1.va = I_1.vb = I_0.vb;
+        stack.push_back(I_1);
+      }
+      if (n_roots == 1 && !I_0.a_on_root && !I_0.b_on_root) {
+        stack.push_back(I_0);
+      }
+      if (I_0.a_on_root) {
+        I_1.a = I_1.b = I_0.a;
+        I_1.va = I_1.vb = I_0.va;
+        stack.push_back(I_1);
+      }
+    }
+
+    /**
+     * \brief Find the next interval of a root separation in increasing order.
+     *
+     * The leftmost interval of the work list is bisected until an interval is
+     * found. The halves are queued with the left one last, so that all the
+     * intervals left in the work list lie to the right of the one found.
+     * \param[in,out] stack Work list of the bisection.
+     * \param[out] I Next interval.
+     * \param[in] options Limits of the separation.
+     * \param[in,out] stats Statistics to be updated.
+     * \param[in,out] ws Workspace of the bisection.
+     * \return True if an interval was found, false if there are no more.
+     */
+    bool next_ordered(Container<Interval, MAX_INTERVALS> &stack,
+                      Interval &I,
+                      const Options &options,
+                      Statistics &stats,
+                      BisectWorkspace &ws) const {
+      bool found{false};
+      while (!found && stack.size() > 0) {
+        Interval I_0{stack.back()};
+        stack.pop_back();
+        auto n_stack{stack.size()};
+        this->bisect(
+            I_0,
+            [&stack](const Interval &I_1) { stack.push_back(I_1); },
+            [&I, &found](const Interval &I_1) {
+              I     = I_1;
+              found = true;
+            },
+            [&options, &stats](const Interval &I_1) {
+              return limit_reached(options, I_1, stats.evaluations);
+            },
+            stats,
+            ws);
+        std::reverse(stack.begin() + n_stack, stack.end());
+      }
+      return found;
+    }
+
+    /**
+     * \brief Sort the computed intervals.
+     *
+     * The intervals are sorted by their bounds, and ties are broken on all the
+     * other fields, so that the order does not depend on the order in which
+     * the intervals were found.
+     * \param[in,out] result Result of the separation.
+     */
+    static void sort_intervals(Result &result) {
+      std::sort(result.intervals.begin(),
+                result.intervals.end(),
+                [](const Interval &I_a, const Interval &I_b) {
+                  return std::tie(I_a.a,
+                                  I_a.b,
+                                  I_a.va,
+                                  I_a.vb,
+                                  I_a.a_on_root,
+                                  I_a.b_on_root,
+                                  I_a.multiplicity,
+                                  I_a.depth,
+                                  I_a.unresolved) < std::tie(I_b.a,
+                                                             I_b.b,
+                                                             I_b.va,
+                                                             I_b.vb,
+                                                             I_b.a_on_root,
+                                                             I_b.b_on_root,
+                                                             I_b.multiplicity,
+                                                             I_b.depth,
+                                                             I_b.unresolved);
+                });
+    }
+
+    /**
+     * \brief Compute the root in an interval after the separation.
+     * \param[in] solve_function Root solver, see \c refine_roots(...).
+     * \param[in] I Interval containing a single root.
+     * \param[out] r Root.
+     * \return True if the root solver converged.
+     */
+    template <typename SolveFunction>
+    bool refine_root(SolveFunction &solve_function,
+                     const Interval &I,
+                     Real &r) const {
+      const Poly<Real, MaxDegree> &p{this->m_sequence[0]};
+      if (I.a_on_root) {
+        r = I.a;
+        return true;
+      } else if (I.b_on_root) {
+        r = I.b;
+        return true;
+      } else if (I.multiplicity > 1) {
+        r = (I.a + I.b) / 2;
+        return true;
+      } else if (I.unresolved) {
+        r = (I.a + I.b) / 2;
+        return false;
+      } else {
+        return Sturm::refine_root(solve_function, I.a, I.b, p, r);
+      }
+    }
 
    public:
+    /**
+     * \brief Lazy search of the roots in increasing order.
+     *
+     * The search bisects the interval depth-first, always processing the
+     * leftmost interval that may hold a root, so that the isolating intervals
+     * are found one at a time in increasing order, and only as far as they
+     * are requested. A caller that only needs the smallest root, or the first
+     * few, is spared the evaluations of the sequence that isolating the
+     * others would take, and the final sort. The intervals are the same as
+     * those of \c separate_roots(a, b, options). The search refers to the
+     * sequence, which must outlive it and must not be rebuilt meanwhile.
+     */
+    class Search {
+      const Sequence *m_sequence; /**< Sturm sequence. */
+      Options m_options;          /**< Limits of the search. */
+      Container<Interval, MAX_INTERVALS>
+          m_stack; /**< Intervals to be processed, the leftmost one last. */
+      Statistics m_statistics;     /**< Statistics of the search so far. */
+      BisectWorkspace m_workspace; /**< Workspace of the bisection. */
+
+     public:
+      /**
+       * \brief Class constructor for the search.
+       *
+       * The sequence is evaluated at the bounds of the interval, the roots
+       * are isolated by the following calls to \c next_interval(...).
+       * \param[in] sequence Sturm sequence.
+       * \param[in] a Lower bound of the interval.
+       * \param[in] b Upper bound of the interval.
+       * \param[in] options Limits of the search.
+       */
+      Search(const Sequence &sequence, Real a, Real b, const Options &options)
+          : m_sequence{&sequence}, m_options{options} {
+        sequence.start_ordered(a, b, this->m_stack, this->m_statistics);
+      }
+
+      /**
+       * \brief Find the next interval of the root separation.
+       * \param[out] I Next interval, to the right of the previous ones.
+       * \return True if an interval was found, false if there are no more.
+       */
+      bool next_interval(Interval &I) {
+        return this->m_sequence->next_ordered(this->m_stack,
+                                              I,
+                                              this->m_options,
+                                              this->m_statistics,
+                                              this->m_workspace);
+      }
+
+      /**
+       * \brief Find and refine the next root.
+       *
+       * The root is computed in the next interval as in \c refine_roots(...).
+       * \param[in] solve_function Root solver, see \c refine_roots(...).
+       * \param[out] r Next root, not smaller than the previous ones.
+       * \param[in] verbose True if the function should print warnings.
+       * \return True if a root was found, false if there are no more.
+       */
+      template <typename SolveFunction>
+      bool next_root(SolveFunction &&solve_function,
+                     Real &r,
+                     bool verbose = false) {
+        Interval I;
+        if (!this->next_interval(I)) {
+          return false;
+        }
+        bool converged{this->m_sequence->refine_root(solve_function, I, r)};
+        STURM_ASSERT_WARNING(
+            converged || !verbose,
+            "Sturm::Sequence::Search::next_root(...): failed at interval ["
+                << I.a << ", " << I.b << "]");
+        return true;
+      }
+
+      /**
+       * \brief Check if all the intervals were found.
+       * \return True if there are no more intervals.
+       */
+      bool done() const {
+        return this->m_stack.size() == 0;
+      }
+
+      /**
+       * \brief Get the statistics of the search so far.
+       * \return The statistics of the search so far.
+       */
+      const Statistics &statistics() const {
+        return this->m_statistics;
+      }
+
+    };  // class Search
+
     /**
      * \brief Class constructor for the Sturm sequence.
      */
@@ -62,7 +940,7 @@ namespace Sturm {
      * \f$.
      * \param[in] p Polynomial.
      */
-    Sequence(const Poly<Real> &p) {
+    Sequence(const Poly<Real, MaxDegree> &p) {
       this->build(p);
     }
 
@@ -71,7 +949,7 @@ namespace Sturm {
      * \return The lower bound of the interval containing the roots.
      */
     Real a() const {
-      return this->m_a;
+      return this->m_result.a;
     }
 
     /**
@@ -79,41 +957,93 @@ namespace Sturm {
      * \return The upper bound of the interval containing the roots.
      */
     Real b() const {
-      return this->m_b;
+      return this->m_result.b;
     }
 
     /**
      * \brief Given the polynomial \f$ p(x) \f$ build its Sturm sequence
+     *
+     * The polynomials of a previously built sequence are overwritten in place,
+     * so that rebuilding the same object for polynomials of the same degree
+     * does not allocate. If the last remainder is a constant (i.e., \f$ p(x)
+     * \f$ is square-free), the division of the sequence by the greatest
+     * common divisor reduces to a scaling.
+     * \param[in] p Polynomial.
      */
-    void build(const Poly<Real> &p) {
-      this->m_intervals.clear();
-      Poly<Real> dp, q, r;
-      p.derivative(dp);
-      this->m_sequence.clear();
-      this->m_sequence.reserve(p.order());
-      this->m_sequence.emplace_back(p);
-      this->m_sequence.back().adjust_degree();
-      this->m_sequence.emplace_back(dp);
-      this->m_sequence.back().adjust_degree();
+    void build(const Poly<Real, MaxDegree> &p) {
+      this->m_result.intervals.clear();
+      this->polynomial(0) = p;
+      this->polynomial(0).adjust_degree();
+      p.derivative(this->polynomial(1));
+      this->polynomial(1).adjust_degree();
       Integer n_sequence{1};
+      DivideWorkspace<Real, MaxDegree> &ws{this->m_workspace};
       while (true) {
-        Sturm::divide<Real>(this->m_sequence[n_sequence - 1],
-                            this->m_sequence[n_sequence],
-                            q,
-                            r);
-        if (r.order() <= 0) {
+        ws.load(this->m_sequence[n_sequence - 1], this->m_sequence[n_sequence]);
+        ws.divide();
+        if (ws.remainder_order() <= 0) {
           break;
         }
-        this->m_sequence.emplace_back(-r);
         ++n_sequence;
+        Poly<Real, MaxDegree> &p_i{this->polynomial(n_sequence)};
+        ws.remainder(p_i);
+        p_i *= -1;
       }
+      this->m_length = n_sequence + 1;
       // Divide by GCD
-      for (Integer i{0}; i < n_sequence; ++i) {
-        Sturm::divide<Real>(this->m_sequence[i], this->m_sequence.back(), q, r);
-        q.normalize();
-        this->m_sequence[i] = q;
+      const Poly<Real, MaxDegree> &gcd{this->m_sequence[n_sequence]};
+      if (gcd.order() == 1) {
+        // Square-free case: the quotients are the polynomials scaled by the
+        // constant GCD, and they are then normalized anyway
+        Real gcd_sign{gcd.coeff(0) > 0 ? Real(1.0) : Real(-1.0)};
+        for (Integer i{0}; i < n_sequence; ++i) {
+          Poly<Real, MaxDegree> &p_i{this->m_sequence[i]};
+          p_i *= gcd_sign / p_i.cwiseAbs().maxCoeff();
+        }
+      } else {
+        for (Integer i{0}; i < n_sequence; ++i) {
+          ws.load(this->m_sequence[i], gcd);
+          ws.divide();
+          ws.quotient(this->m_sequence[i]);
+          this->m_sequence[i].normalize();
+        }
+      }
+      this->m_sequence[n_sequence].set_scalar(1);
+      this->pack();
+      Real n_epsilon{static_cast<Real>(this->m_sequence[0].order()) *
+                     std::numeric_limits<Real>::epsilon()};
+      for (Integer k{1}; k <= CLUSTER_ORDER; ++k) {
+        this->m_cluster_width[k] =
+            CLUSTER_WIDTH * std::pow(n_epsilon, Real(1.0) / k);
+      }
+    }
+
+    /**
+     * \brief Pack the stored Sturm sequence into a single buffer.
+     *
+     * All the coefficients are stored in one aligned row-major matrix, whose
+     * \f$ k \f$-th row holds the \f$ k \f$-th coefficients of all the
+     * polynomials of the sequence, zero-padded up to a multiple of \c LANES
+     * columns. In this way, consecutive polynomials sit in consecutive SIMD
+     * lanes and a group of \c LANES polynomials is evaluated by a single Horner
+     * pass. The number of Horner steps of each group is given by its maximum
+     * order.
+     */
+    void pack() {
+      Integer n_poly{this->length()};
+      Integer n_groups{(n_poly + LANES - 1) / LANES};
+      Integer max_order{1};
+      for (Integer i{0}; i < n_poly; ++i) {
+        max_order = std::max(max_order, this->m_sequence[i].order());
+      }
+      this->m_packed.setZero(max_order, n_groups * LANES);
+      this->m_packed_order.assign(n_groups, 1);
+      for (Integer i{0}; i < n_poly; ++i) {
+        const Poly<Real, MaxDegree> &p{this->m_sequence[i]};
+        this->m_packed.col(i).head(p.order()) = p.to_eigen();
+        Integer &order{this->m_packed_order[i / LANES]};
+        order = std::max(order, p.order());
       }
-      this->m_sequence.back().set_scalar(1);
     }
 
     /**
@@ -121,52 +1051,102 @@ namespace Sturm {
      * \return Length of the stored Sturm sequence.
      */
     Integer length() const {
-      return static_cast<Integer>(this->m_sequence.size());
+      return this->m_length;
     }
 
     /**
      * \brief  Get the \f$ i \f$-th polynomial of the stored Sturm sequence.
      * \return The \f$ i \f$-th polynomial of the stored Sturm sequence.
      */
-    const Poly<Real> &get(Integer i) const {
+    const Poly<Real, MaxDegree> &get(Integer i) const {
       return this->m_sequence[i];
     }
 
     /**
      * Compute the sign variations of the stored Sturm sequence at \f$ x \f$.
+     * The signs are certified if enabled, see \c set_certified(...), else
+     * evaluated with the strategy of \c set_evaluation(...).
      * \return The number of sign variations.
      */
     Integer sign_variations(Real x, bool &on_root) const {
+      if (this->m_certified) {
+        bool uncertain;
+        Integer escalations{0};
+        return this->certified_sign_variations(
+            x, on_root, uncertain, escalations);
+      }
+      if (this->m_evaluation != Evaluation::NATIVE) {
+        return this->evaluated_sign_variations(x, on_root);
+      }
+      using Lanes = Eigen::Array<Real, 1, LANES>;
       Integer sign_var{0};
       Integer last_sign{0};
-      Integer n_poly{Integer(this->m_sequence.size())};
-      Real v{this->m_sequence[0].evaluate(x)};
+      Integer n_poly{this->length()};
       on_root = false;
-      if (v > 0) {
-        last_sign = 1;
-      } else if (v < 0) {
-        last_sign = -1;
-      } else {
-        on_root   = true;
-        last_sign = 0;
-      }
-      for (Integer i{1}; i < n_poly; ++i) {
-        v = this->m_sequence[i].evaluate(x);
-        if (v > 0) {
-          if (last_sign == -1) {
-            ++sign_var;
-          }
-          last_sign = 1;
-        } else if (v < 0) {
-          if (last_sign == 1) {
-            ++sign_var;
-          }
-          last_sign = -1;
+      for (Integer i{0}, g{0}; i < n_poly; ++g) {
+        // Evaluate a group of polynomials in a single lane-parallel Horner pass
+        Integer n{this->m_packed_order[g] - 1};
+        Lanes v{this->m_packed.template block<1, LANES>(n, g * LANES)};
+        while (n-- > 0) {
+          v = v * x +
+              this->m_packed.template block<1, LANES>(n, g * LANES).array();
+        }
+        for (Integer l{0}; l < LANES && i < n_poly; ++l, ++i) {
+          Real v_l{v.coeff(l)};
+          add_sign(v_l, i, last_sign, sign_var, on_root);
         }
       }
       return sign_var;
     }
 
+    /**
+     * \brief Compute the sign variations of the stored Sturm sequence at a
+     * batch of points.
+     *
+     * The points are processed in blocks of \c Poly::BLOCK_SIZE. Each
+     * polynomial of the sequence is evaluated over a whole block with the
+     * batched Horner scheme, and the sign variations are accumulated with
+     * array selections instead of branches, so that the counting is vectorized
+     * as well.
+     * \param[in] x Points at which to compute the sign variations.
+     * \param[out] sign_var Number of sign variations at the given points.
+     * \param[out] on_root True if the given point is a root of \f$ p(x) \f$.
+     */
+    void sign_variations(std::span<const Real> x,
+                         std::span<Integer> sign_var,
+                         std::span<bool> on_root) const {
+      STURM_ASSERT(x.size() == sign_var.size() && x.size() == on_root.size(),
+                   "Sturm::Sequence::sign_variations(...): input and output "
+                   "sizes do not match.");
+      constexpr Integer BLOCK_SIZE{Poly<Real, MaxDegree>::BLOCK_SIZE};
+      Eigen::Array<Real, BLOCK_SIZE, 1> v, v_sign, last_sign;
+      Eigen::Array<Integer, BLOCK_SIZE, 1> var;
+      Integer n_poly{this->m_length};
+      Integer n_points{static_cast<Integer>(x.size())};
+      for (Integer i{0}; i < n_points; i += BLOCK_SIZE) {
+        Integer n_block{std::min(BLOCK_SIZE, n_points - i)};
+        std::span<const Real> x_block{x.subspan(i, n_block)};
+        std::span<Real> v_block{v.data(), static_cast<std::size_t>(n_block)};
+        this->m_sequence[0].evaluate(x_block, v_block);
+        last_sign.head(n_block) = v.head(n_block).sign();
+        var.head(n_block).setZero();
+        for (Integer j{0}; j < n_block; ++j) {
+          on_root[i + j] = v.coeff(j) == 0;
+        }
+        for (Integer k{1}; k < n_poly; ++k) {
+          this->m_sequence[k].evaluate(x_block, v_block);
+          v_sign.head(n_block) = v.head(n_block).sign();
+          var.head(n_block) +=
+              (v_sign.head(n_block) * last_sign.head(n_block) < 0)
+                  .template cast<Integer>();
+          last_sign.head(n_block) = (v_sign.head(n_block) != 0)
+                                        .select(v_sign.head(n_block),
+                                                last_sign.head(n_block));
+        }
+        std::copy_n(var.data(), n_block, sign_var.begin() + i);
+      }
+    }
+
     /**
      * \brief Compute the subintervals containing a single root.
      *
@@ -175,139 +1155,540 @@ namespace Sturm {
      * \return The numbers of intervals (roots) found.
      */
     Integer separate_roots(Real a_in, Real b_in) {
-      this->m_intervals.clear();
-      this->m_intervals.reserve(this->m_sequence.size());
-
-      Interval I_0, I_1;
-      this->m_a = I_0.a = a_in;
-      this->m_b = I_0.b = b_in;
+      return this->separate_roots(a_in, b_in, Options());
+    }
 
-      I_0.va = this->sign_variations(I_0.a, I_0.a_on_root);
-      I_0.vb = this->sign_variations(I_0.b, I_0.b_on_root);
+    /**
+     * \brief Compute the subintervals containing a single root within the
+     * given limits.
+     *
+     * Same as \c separate_roots(a, b), but the bisection stops at the limits
+     * on the evaluations of the sequence, on the bisections leading to an
+     * interval, and on the wall-clock time. The limits are checked before
+     * each bisection, so that the evaluations may exceed their limit by the
+     * few of a single step. The intervals that still hold several roots are
+     * then stored as they are, flagged by \c Interval::unresolved, and
+     * counted in \c Statistics::unresolved, so that every root of \f$ [a, b]
+     * \f$ lies in one of the intervals found.
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[in] options Limits of the separation.
+     * \return The numbers of intervals found.
+     */
+    Integer separate_roots(Real a_in, Real b_in, const Options &options) {
+      return this->separate_roots(a_in, b_in, this->m_result, options);
+    }
 
-      Integer n_roots{std::abs(I_0.va - I_0.vb)};
+    /**
+     * \brief Compute the subintervals containing a single root into a given
+     * result.
+     *
+     * Same as \c separate_roots(a, b), but the intervals, the bounds and the
+     * statistics are stored in the given result instead of the sequence,
+     * which is left untouched. The buffers of the result are reused, so that
+     * a result kept across the queries does not allocate once it is large
+     * enough.
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[out] result Result of the separation.
+     * \return The numbers of intervals (roots) found.
+     */
+    Integer separate_roots(Real a_in, Real b_in, Result &result) const {
+      return this->separate_roots(a_in, b_in, result, Options());
+    }
 
-      if (n_roots <= 1) {
-        if (n_roots == 1 && !I_0.a_on_root && !I_0.b_on_root) {
-          this->m_intervals.push_back(I_0);
-        }
-        if (I_0.a_on_root) {
-          I_1.a = I_1.b = I_0.a;
-          I_1.va = I_1.vb = I_0.va;
-          I_1.a_on_root = I_1.b_on_root = true;
-          this->m_intervals.push_back(I_1);
-        }
-        if (I_0.b_on_root) {
-          I_1.a = I_1.b = I_0.b;
-          I_1.va = I_1.vb = I_0.vb;
-          I_1.a_on_root = I_1.b_on_root = true;
-          this->m_intervals.push_back(I_1);
-        }
-        return static_cast<Integer>(m_intervals.size());
+    /**
+     * \brief Compute the subintervals containing a single root into a given
+     * result within the given limits.
+     *
+     * Same as \c separate_roots(a, b, result), but within the limits of \c
+     * separate_roots(a, b, options).
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[out] result Result of the separation.
+     * \param[in] options Limits of the separation.
+     * \return The numbers of intervals found.
+     */
+    Integer separate_roots(Real a_in,
+                           Real b_in,
+                           Result &result,
+                           const Options &options) const {
+      Interval I_0;
+      if (this->separate_bounds(a_in, b_in, I_0, result)) {
+        return static_cast<Integer>(result.intervals.size());
       }
 
       // Search intervals
-      std::vector<Interval> I_stack;
+      Container<Interval, MAX_INTERVALS> &I_stack{result.stack};
       I_stack.clear();
-      I_stack.reserve(this->m_sequence.size());
+      I_stack.reserve(this->m_length);
       I_stack.push_back(I_0);
       while (I_stack.size() > 0) {
         I_0 = I_stack.back();
         I_stack.pop_back();
-        // Check if the interval has a single root
-        n_roots = std::abs(I_0.va - I_0.vb);
-        if (n_roots <= 1) {
-          if (I_0.a_on_root) {
-            I_0.b         = I_0.a;
-            I_0.vb        = I_0.va;
-            I_0.b_on_root = true;
-            this->m_intervals.push_back(I_0);
-          } else if (I_0.b_on_root) {
-            I_0.a         = I_0.b;
-            I_0.va        = I_0.vb;
-            I_0.a_on_root = true;
-            this->m_intervals.push_back(I_0);
-          } else if (n_roots == 1) {
-            this->m_intervals.push_back(I_0);
-          }
-        } else if (std::abs(I_0.b - I_0.a) <=
-                   static_cast<Real>(10.0) *
-                       std::numeric_limits<Real>::epsilon() *
-                       std::max(static_cast<Real>(1.0),
-                                std::max(std::abs(I_0.b), std::abs(I_0.a)))) {
-          I_1.a = I_1.b = I_0.a;
-          I_1.va = I_1.vb = 0;
-          I_1.a_on_root = I_1.b_on_root = true;
-          I_stack.push_back(I_1);
-        } else {
-          Real c{(I_0.a + I_0.b) / static_cast<Real>(2.0)};
-          bool c_on_root;
-          Integer vc{this->sign_variations(c, c_on_root)};
-          // Check the interval [a, c]
-          if (I_0.va != vc || c_on_root || I_0.a_on_root) {
-            if (c < I_0.b) {  // Check if it is a true reduction
-              I_1.a         = I_0.a;
-              I_1.va        = I_0.va;
-              I_1.a_on_root = I_0.a_on_root;
-              I_1.b         = c;
-              I_1.vb        = vc;
-              I_1.b_on_root = c_on_root;
-              I_stack.push_back(I_1);
-            } else if (c_on_root) {
-              I_1.a = I_1.b = c;
-              I_1.a_on_root = I_1.b_on_root = true;
-              I_1.va = I_1.vb = 0;
-              I_stack.push_back(I_1);
-            } else if (I_0.a_on_root) {
-              I_1.a = I_1.b = I_0.a;
-              I_1.a_on_root = I_1.b_on_root = true;
-              I_1.va = I_1.vb = 0;
-              I_stack.push_back(I_1);
+        this->bisect(
+            I_0,
+            [&I_stack](const Interval &I) { I_stack.push_back(I); },
+            [&result](const Interval &I) { result.intervals.push_back(I); },
+            [&result, &options](const Interval &I) {
+              return limit_reached(options, I, result.statistics.evaluations);
+            },
+            result.statistics,
+            result.workspace);
+      }
+      sort_intervals(result);
+      return static_cast<Integer>(result.intervals.size());
+    }
+
+    /**
+     * \brief Compute the subintervals containing a single root into separate
+     * arrays.
+     *
+     * Same as \c separate_roots(a, b, result), but the intervals are found in
+     * increasing order by a depth-first bisection on the leftmost interval
+     * (see \c Search), hence they need no sorting, and their bounds and flags
+     * are stored in separate contiguous arrays, ready to be mapped, e.g., by
+     * \c Eigen::Map. The arrays, the work list and the workspace of the
+     * brackets are reused, so that the calls on brackets kept across the
+     * queries do not allocate once these are large enough, and never
+     * allocate if the maximum degree is given at compile time.
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[out] brackets Intervals of the separation.
+     * \return The numbers of intervals (roots) found.
+     */
+    Integer separate_roots(Real a_in, Real b_in, Brackets &brackets) const {
+      return this->separate_roots(a_in, b_in, brackets, Options());
+    }
+
+    /**
+     * \brief Compute the subintervals containing a single root into separate
+     * arrays within the given limits.
+     *
+     * Same as \c separate_roots(a, b, brackets), but within the limits of \c
+     * separate_roots(a, b, options).
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[out] brackets Intervals of the separation.
+     * \param[in] options Limits of the separation.
+     * \return The numbers of intervals found.
+     */
+    Integer separate_roots(Real a_in,
+                           Real b_in,
+                           Brackets &brackets,
+                           const Options &options) const {
+      brackets.a.clear();
+      brackets.b.clear();
+      brackets.flags.clear();
+      brackets.statistics = Statistics();
+      this->start_ordered(a_in, b_in, brackets.stack, brackets.statistics);
+      Interval I;
+      while (this->next_ordered(brackets.stack,
+                                I,
+                                options,
+                                brackets.statistics,
+                                brackets.workspace)) {
+        brackets.a.push_back(I.a);
+        brackets.b.push_back(I.b);
+        brackets.flags.push_back((I.a_on_root ? A_ON_ROOT : 0) |
+                                 (I.b_on_root ? B_ON_ROOT : 0) |
+                                 (I.multiplicity > 1 ? CLUSTER : 0) |
+                                 (I.unresolved ? UNRESOLVED : 0));
+      }
+      return static_cast<Integer>(brackets.a.size());
+    }
+
+    /**
+     * \brief Compute the subintervals containing a single root in parallel.
+     *
+     * Same as \c separate_roots(a, b), but the subintervals are bisected by
+     * the tasks of a work-stealing thread pool. Each task proceeds
+     * depth-first on the last half of its work list and queues the oldest
+     * interval if this holds at least \c PARALLEL_ROOTS roots, so that idle
+     * threads steal the largest pending intervals and the few roots left at
+     * the bottom of the bisection are not worth a task. The running tasks take
+     * their work lists and workspaces from a free list, so that these are
+     * reused across the tasks. An exception thrown by a task is rethrown once
+     * all the tasks have returned. The bisection of
+     * an interval does not depend on the order in which the intervals are
+     * processed, and the intervals are sorted at the end, hence the result is
+     * the same as the serial one.
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[in] pool Thread pool.
+     * \return The numbers of intervals (roots) found.
+     */
+    Integer separate_roots(Real a_in, Real b_in, ThreadPool &pool) {
+      return this->separate_roots(a_in, b_in, pool, Options());
+    }
+
+    /**
+     * \brief Compute the subintervals containing a single root in parallel
+     * within the given limits.
+     *
+     * Same as \c separate_roots(a, b, options), with the bisection of \c
+     * separate_roots(a, b, pool). The evaluations are counted across the
+     * tasks, and the intervals left unresolved depend on the scheduling.
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[in] pool Thread pool.
+     * \param[in] options Limits of the separation.
+     * \return The numbers of intervals found.
+     */
+    Integer separate_roots(Real a_in,
+                           Real b_in,
+                           ThreadPool &pool,
+                           const Options &options) {
+      Result &result{this->m_result};
+      Interval I_0;
+      if (this->separate_bounds(a_in, b_in, I_0, result)) {
+        return static_cast<Integer>(result.intervals.size());
+      }
+
+      // Search intervals, each running task with a workspace of the free list
+      using Worker = struct Worker {
+        Container<Interval, MAX_INTERVALS> stack;     /**< Work list. */
+        Container<Interval, MAX_INTERVALS> intervals; /**< Intervals found. */
+        Statistics statistics;     /**< Statistics of the tasks. */
+        BisectWorkspace workspace; /**< Workspace of the bisection. */
+      };
+      std::mutex mutex;
+      std::vector<std::unique_ptr<Worker>> workers;
+      std::vector<Worker *> idle;
+      std::exception_ptr error;
+      std::atomic<Integer> pending{1};
+      std::atomic<Integer> evaluations{result.statistics.evaluations};
+      std::function<void(const Interval &)> task;
+      task = [this,
+              &pool,
+              &mutex,
+              &workers,
+              &idle,
+              &error,
+              &pending,
+              &evaluations,
+              &options,
+              &task](const Interval &I_t) {
+        Worker *w{nullptr};
+        try {
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (idle.empty()) {
+              workers.push_back(std::make_unique<Worker>());
+              idle.push_back(workers.back().get());
             }
+            w = idle.back();
+            idle.pop_back();
           }
-          // Check the interval [c, b]
-          if (I_0.vb != vc || I_0.b_on_root) {
-            if (c > I_0.a) {
-              I_1.a         = c;
-              I_1.va        = vc;
-              I_1.a_on_root = c_on_root;
-              I_1.b         = I_0.b;
-              I_1.vb        = I_0.vb;
-              I_1.b_on_root = I_0.b_on_root;
-              I_stack.push_back(I_1);
-            } else if (I_0.b_on_root) {
-              I_1.a = I_1.b = I_0.b;
-              I_1.a_on_root = I_1.b_on_root = true;
-              I_1.va = I_1.vb = 0;
-              I_stack.push_back(I_1);
+          Container<Interval, MAX_INTERVALS> &I_stack{w->stack};
+          Statistics &stats{w->statistics};
+          I_stack.clear();
+          I_stack.push_back(I_t);
+          while (I_stack.size() > 0) {
+            Interval I_i{I_stack.back()};
+            I_stack.pop_back();
+            Integer n_evaluations{stats.evaluations};
+            this->bisect(
+                I_i,
+                [&I_stack](const Interval &I) { I_stack.push_back(I); },
+                [w](const Interval &I) { w->intervals.push_back(I); },
+                [&evaluations, &options](const Interval &I) {
+                  return limit_reached(options, I, evaluations.load());
+                },
+                stats,
+                w->workspace);
+            evaluations += stats.evaluations - n_evaluations;
+            // Keep the last half and hand the oldest interval to the pool, if
+            // it has enough roots to be worth a task
+            if (I_stack.size() > 1 &&
+                std::abs(I_stack[0].va - I_stack[0].vb) >=
+                    PARALLEL_ROOTS) {
+              ++pending;
+              try {
+                pool.push([&task, I = I_stack[0]]() { task(I); });
+              } catch (...) {
+                --pending;
+                throw;
+              }
+              I_stack[0] = I_stack.back();
+              I_stack.pop_back();
             }
           }
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (!error) {
+            error = std::current_exception();
+          }
         }
+        if (w != nullptr) {
+          std::lock_guard<std::mutex> lock(mutex);
+          idle.push_back(w);
+        }
+        --pending;
+      };
+      task(I_0);
+      pool.wait_until([&pending]() { return pending.load() == 0; });
+      if (error) {
+        std::rethrow_exception(error);
       }
-      // Sort intervals
-      std::sort(this->m_intervals.begin(),
-                this->m_intervals.end(),
-                [](const Interval &I_a, const Interval &I_b) {
-                  return I_a.a < I_b.a;
-                });
-      return static_cast<Integer>(m_intervals.size());
+      for (const std::unique_ptr<Worker> &w : workers) {
+        for (const Interval &I : w->intervals) {
+          result.intervals.push_back(I);
+        }
+        result.statistics += w->statistics;
+      }
+      sort_intervals(result);
+      return static_cast<Integer>(result.intervals.size());
     }
 
     /**
      * \brief Compute all the subintervals containing a single root in \f$ [a,
      * b] \f$.
      *
-     * Compute an interval \f$ [a, b] \f$ that contains all the real roots and
-     * compute the subintervals containing a single root.
+     * Compute an interval \f$ [a, b] \f$ that contains all the real roots (see
+     * \c Poly::root_bounds(...)) and compute the subintervals containing a
+     * single root.
      * \return The numbers of intervals (roots) found.
      */
     Integer separate_roots() {
-      // Cauchy's bounds for roots
-      Real leading_coeff{this->m_sequence[0].leading_coeff()};
-      Real bound{static_cast<Real>(1.0) +
-                 this->m_sequence[0].cwiseAbs().maxCoeff() /
-                     std::abs(leading_coeff)};
-      return separate_roots(-bound, bound);
+      return this->separate_roots(Options());
+    }
+
+    /**
+     * \brief Compute all the subintervals containing a single root within the
+     * given limits.
+     *
+     * Same as \c separate_roots(), but within the limits of \c
+     * separate_roots(a, b, options).
+     * \param[in] options Limits of the separation.
+     * \return The numbers of intervals found.
+     */
+    Integer separate_roots(const Options &options) {
+      Real a, b;
+      this->m_sequence[0].root_bounds(a, b);
+      return this->separate_roots(a, b, options);
+    }
+
+    /**
+     * \brief Count the distinct real roots in an interval.
+     *
+     * The roots in \f$ (a, b] \f$ are given by the difference of the sign
+     * variations at the bounds, hence the sequence is only evaluated twice.
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \return The number of distinct real roots in \f$ (a, b] \f$.
+     */
+    Integer count_roots(Real a_in, Real b_in) const {
+      bool a_on_root, b_on_root;
+      return std::abs(this->sign_variations(a_in, a_on_root) -
+                      this->sign_variations(b_in, b_on_root));
+    }
+
+    /**
+     * \brief Count the distinct real roots between consecutive breakpoints.
+     *
+     * The sequence is evaluated once at each breakpoint, and the roots in
+     * \f$ (x_i, x_{i+1}] \f$ are given by the difference of the sign
+     * variations at its bounds, so that a shared bound is never evaluated
+     * twice. The breakpoints need not be sorted, the count of a pair does not
+     * depend on its order. A single point evaluation is used, since the
+     * packed sequence is evaluated faster one point at a time than over a
+     * batch of points.
+     * \param[in] breakpoints Breakpoints \f$ x_0, x_1, \ldots, x_n \f$.
+     * \param[out] counts Number of distinct real roots between \f$ x_i \f$
+     * and \f$ x_{i+1} \f$, for \f$ i = 0, 1, \ldots, n-1 \f$.
+     * \return The sum of the counts, i.e., the number of distinct real roots
+     * in \f$ (x_0, x_n] \f$ if the breakpoints are sorted.
+     */
+    Integer count_roots(std::span<const Real> breakpoints,
+                        std::span<Integer> counts) const {
+      STURM_ASSERT(breakpoints.size() == counts.size() + 1,
+                   "Sturm::Sequence::count_roots(...): there must be one "
+                   "more breakpoint than counts.");
+      bool on_root;
+      Integer n_roots{0};
+      Integer v_a{this->sign_variations(breakpoints[0], on_root)};
+      for (std::size_t i{0}; i < counts.size(); ++i) {
+        Integer v_b{this->sign_variations(breakpoints[i + 1], on_root)};
+        counts[i] = std::abs(v_a - v_b);
+        n_roots += counts[i];
+        v_a = v_b;
+      }
+      return n_roots;
+    }
+
+    /**
+     * \brief Count all the distinct real roots.
+     *
+     * The signs of the sequence at \f$ \pm\infty \f$ are those of the
+     * leading coefficients, changed at \f$ -\infty \f$ for the polynomials
+     * of odd degree, hence the sequence is not evaluated at all.
+     * \return The number of distinct real roots.
+     */
+    Integer count_roots() const {
+      Integer v_minus{0}, v_plus{0}, last_minus{0}, last_plus{0};
+      for (Integer i{0}; i < this->m_length; ++i) {
+        const Poly<Real, MaxDegree> &p_i{this->m_sequence[i]};
+        Real leading{p_i.leading_coeff()};
+        if (leading == 0) {
+          continue;
+        }
+        Integer sign_plus{leading > 0 ? 1 : -1};
+        Integer sign_minus{p_i.degree() % 2 == 0 ? sign_plus : -sign_plus};
+        v_plus += last_plus == -sign_plus;
+        v_minus += last_minus == -sign_minus;
+        last_plus  = sign_plus;
+        last_minus = sign_minus;
+      }
+      return v_minus - v_plus;
+    }
+
+    /**
+     * \brief Start a lazy search of the roots in increasing order.
+     *
+     * Same intervals as \c separate_roots(a, b), but found one at a time by
+     * the returned search, see \c Search. The intervals of the last root
+     * separation are left as they are.
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \return The search of the roots in \f$ [a, b] \f$.
+     */
+    Search search(Real a_in, Real b_in) const {
+      return Search(*this, a_in, b_in, Options());
+    }
+
+    /**
+     * \brief Start a lazy search of the roots in increasing order within the
+     * given limits.
+     *
+     * Same as \c search(a, b), but within the limits of \c separate_roots(a,
+     * b, options).
+     * \param[in] a_in Lower bound of the interval.
+     * \param[in] b_in Upper bound of the interval.
+     * \param[in] options Limits of the search.
+     * \return The search of the roots in \f$ [a, b] \f$.
+     */
+    Search search(Real a_in, Real b_in, const Options &options) const {
+      return Search(*this, a_in, b_in, options);
+    }
+
+    /**
+     * \brief Start a lazy search of all the roots in increasing order.
+     *
+     * Same as \c search(a, b) on the bounds of \c separate_roots().
+     * \return The search of all the roots.
+     */
+    Search search() const {
+      Real a, b;
+      this->m_sequence[0].root_bounds(a, b);
+      return Search(*this, a, b, Options());
+    }
+
+    /**
+     * \brief Enable or disable the Descartes filter of the bisection.
+     *
+     * When enabled, the sign variations at the midpoint of an interval are
+     * deduced, when possible, from Descartes' rule of signs on \f$ p_0(x)
+     * \f$ instead of evaluating the whole sequence. The roots found are the
+     * same, the evaluations saved are counted in the statistics. Each test
+     * costs four Taylor shifts of \f$ p_0(x) \f$, which is more than a
+     * lane-parallel evaluation of the sequence, so that the separation is
+     * about an order of magnitude slower (see \c bench_filter) even though
+     * fewer evaluations are made. The filter is then disabled by default, and
+     * only pays off where an evaluation of the sequence costs more than the
+     * transforms of \f$ p_0(x) \f$.
+     * \param[in] filter True to enable the filter.
+     */
+    void set_filter(bool filter) {
+      this->m_filter = filter;
+    }
+
+    /**
+     * \brief Check if the Descartes filter of the bisection is enabled.
+     * \return True if the filter is enabled.
+     */
+    bool filter() const {
+      return this->m_filter;
+    }
+
+    /**
+     * \brief Enable or disable the cluster detection of the bisection.
+     *
+     * When enabled, an interval with \f$ k > 1 \f$ roots that the sequence
+     * can no longer separate is reported as a cluster as soon as Pellet's
+     * test proves that it holds them, see \c detect_cluster(...) and \c
+     * Interval::multiplicity. A refined root of a cluster is the midpoint of
+     * its interval. The detection is disabled by default.
+     * \param[in] clusters True to enable the detection.
+     */
+    void set_cluster_detection(bool clusters) {
+      this->m_clusters = clusters;
+    }
+
+    /**
+     * \brief Check if the cluster detection of the bisection is enabled.
+     * \return True if the detection is enabled.
+     */
+    bool cluster_detection() const {
+      return this->m_clusters;
+    }
+
+    /**
+     * \brief Enable or disable the certified signs of the sequence.
+     *
+     * When enabled, the sign variations at a point only rely on the signs
+     * that the rounding errors cannot flip, see \c
+     * certified_sign_variations(...). The uncertain ones, which only occur
+     * close to the roots of the polynomials of the sequence, are evaluated
+     * by the compensated Horner scheme and counted in the statistics. A
+     * point where the sign of \f$ p_0(x) \f$ is still uncertain is not taken
+     * as a root: the bisection tries the nearby points instead, and an
+     * interval that none of them can split is stored as unresolved. The
+     * running error bound makes the root separation up to half as slow
+     * again, hence the mode is disabled by default.
+     * \param[in] certified True to enable the certified signs.
+     */
+    void set_certified(bool certified) {
+      this->m_certified = certified;
+    }
+
+    /**
+     * \brief Check if the certified signs of the sequence are enabled.
+     * \return True if the certified signs are enabled.
+     */
+    bool certified() const {
+      return this->m_certified;
+    }
+
+    /**
+     * \brief Set the evaluation strategy of the signs of the sequence.
+     *
+     * The compensated and double-word strategies keep the signs right much
+     * closer to the roots of the polynomials of the sequence, at a few times
+     * the cost of the packed native evaluation, see \c Evaluation. They do
+     * not apply in the certified mode, whose uncertain signs are already
+     * evaluated by the compensated scheme, and to the evaluations at a batch
+     * of points.
+     * \param[in] evaluation Evaluation strategy.
+     */
+    void set_evaluation(Evaluation evaluation) {
+      this->m_evaluation = evaluation;
+    }
+
+    /**
+     * \brief Get the evaluation strategy of the signs of the sequence.
+     * \return The evaluation strategy.
+     */
+    Evaluation evaluation() const {
+      return this->m_evaluation;
+    }
+
+    /**
+     * \brief Get the statistics of the last root separation.
+     * \return The statistics of the last root separation.
+     */
+    const Statistics &statistics() const {
+      return this->m_result.statistics;
     }
 
     /**
@@ -315,7 +1696,7 @@ namespace Sturm {
      * \return The number of roots found.
      */
     Integer roots_number() const {
-      return static_cast<Integer>(this->m_intervals.size());
+      return static_cast<Integer>(this->m_result.intervals.size());
     }
 
     /**
@@ -323,40 +1704,210 @@ namespace Sturm {
      * \return The \f$ i \f$-th interval containing a single root.
      */
     const Interval &interval(Integer i) const {
-      return this->m_intervals[i];
+      return this->m_result.intervals[i];
+    }
+
+    /**
+     * \brief Get the result of the last root separation.
+     * \return The result of the last root separation.
+     */
+    const Result &result() const {
+      return this->m_result;
     }
 
     /**
      * \brief Compute the roots in the intervals after the separation.
-     * \param[in] solve_function Lambda function for the root solver.
+     *
+     * The root solver is either a built-in refiner (\c Newton, \c Brent, \c
+     * ITP, \c QIR), which is handed the polynomial itself so that every
+     * evaluation is inlined, or a lambda function, which is handed the
+     * polynomial wrapped into a \c std::function.
+     * \param[in] solve_function Root solver.
      * \param[in] verbose True if the function should print warnings.
      * \return A vector with the computed roots.
-     * \tparam Solver Lambda function for the root solver with the signature
+     * \tparam SolveFunction Refiner with the member `bool solve(Real a, Real b,
+     * const Poly &p, Real & x) const`, or lambda function with the signature
      * `bool(Real a, Real b, std::function<Real(Real)> f, Real & x)`.
      */
     template <typename SolveFunction>
     Vector refine_roots(SolveFunction &&solve_function, bool verbose = false) {
-      auto function = std::function<Real(Real x)>([this](Real x) {
-        return this->m_sequence[0].evaluate(x);
+      this->refine_roots(solve_function, this->m_result, verbose);
+      return this->m_result.roots;
+    }
+
+    /**
+     * \brief Compute the roots in the intervals of a given result.
+     *
+     * Same as \c refine_roots(solve_function, verbose), but on the intervals
+     * of a result of \c separate_roots(a, b, result), whose roots are
+     * stored in \c Result::roots.
+     * \param[in] solve_function Root solver.
+     * \param[in,out] result Result of the separation.
+     * \param[in] verbose True if the function should print warnings.
+     * \return True if the root solver converged in all the intervals.
+     * \tparam SolveFunction Refiner with the member `bool solve(Real a, Real b,
+     * const Poly &p, Real & x) const`, or lambda function with the signature
+     * `bool(Real a, Real b, std::function<Real(Real)> f, Real & x)`.
+     */
+    template <typename SolveFunction>
+    bool refine_roots(SolveFunction &&solve_function,
+                      Result &result,
+                      bool verbose = false) const {
+      Integer n_roots{static_cast<Integer>(result.intervals.size())};
+      result.roots.resize(n_roots);
+      bool converged_all{true};
+      for (Integer n{0}; n < n_roots; ++n) {
+        bool converged{this->refine_root(
+            solve_function, result.intervals[n], result.roots.coeffRef(n))};
+        STURM_ASSERT_WARNING(
+            converged || !verbose,
+            "Sturm::Sequence::refine_roots(...): failed at interval n = "
+                << n + 1);
+        converged_all = converged_all && converged;
+      }
+      return converged_all;
+    }
+
+    /**
+     * \brief Compute the roots in the intervals after the separation in
+     * parallel.
+     *
+     * Same as \c refine_roots(solve_function, verbose), but the isolating
+     * intervals are refined concurrently by the threads of the pool. The root
+     * solver is called from several threads at once, so it must not modify
+     * any shared state.
+     * \param[in] solve_function Root solver.
+     * \param[in] pool Thread pool.
+     * \param[in] verbose True if the function should print warnings.
+     * \return A vector with the computed roots.
+     * \tparam SolveFunction Refiner with the member `bool solve(Real a, Real b,
+     * const Poly &p, Real & x) const`, or lambda function with the signature
+     * `bool(Real a, Real b, std::function<Real(Real)> f, Real & x)`.
+     */
+    template <typename SolveFunction>
+    Vector refine_roots(SolveFunction &&solve_function,
+                        ThreadPool &pool,
+                        bool verbose = false) {
+      this->refine_roots(solve_function, this->m_result, pool, verbose);
+      return this->m_result.roots;
+    }
+
+    /**
+     * \brief Compute the roots in the intervals of a given result in
+     * parallel.
+     *
+     * Same as \c refine_roots(solve_function, pool, verbose), but on the
+     * intervals of a result of \c separate_roots(a, b, result), whose roots
+     * are stored in \c Result::roots.
+     * \param[in] solve_function Root solver.
+     * \param[in,out] result Result of the separation.
+     * \param[in] pool Thread pool.
+     * \param[in] verbose True if the function should print warnings.
+     * \return True if the root solver converged in all the intervals.
+     * \tparam SolveFunction Refiner with the member `bool solve(Real a, Real b,
+     * const Poly &p, Real & x) const`, or lambda function with the signature
+     * `bool(Real a, Real b, std::function<Real(Real)> f, Real & x)`.
+     */
+    template <typename SolveFunction>
+    bool refine_roots(SolveFunction &&solve_function,
+                      Result &result,
+                      ThreadPool &pool,
+                      bool verbose = false) const {
+      Integer n_roots{static_cast<Integer>(result.intervals.size())};
+      result.roots.resize(n_roots);
+      std::atomic<bool> converged_all{true};
+      pool.parallel_for(n_roots, [&](Integer n) {
+        bool converged{this->refine_root(
+            solve_function, result.intervals[n], result.roots.coeffRef(n))};
+        STURM_ASSERT_WARNING(
+            converged || !verbose,
+            "Sturm::Sequence::refine_roots(...): failed at interval n = "
+                << n + 1);
+        if (!converged) {
+          converged_all = false;
+        }
       });
-      Vector roots(this->m_intervals.size());
-      Integer n{0};
-      bool converged{false};
-      for (auto &I : this->m_intervals) {
-        Real &r{roots.coeffRef(n++)};
-        if (I.a_on_root) {
-          r = I.a;
-        } else if (I.b_on_root) {
-          r = I.b;
+      return converged_all.load();
+    }
+
+    /**
+     * \brief Shrink the intervals after the separation to certified brackets.
+     *
+     * Each interval is shrunk in place by the quadratic interval refinement
+     * (see \c QIR) until its width is within the tolerance, so that the
+     * intervals stay disjoint and sorted. The sign variations at the bounds
+     * are still valid, since they only change at the roots. If the
+     * polynomial does not change sign in the interval, i.e., the root has an
+     * even multiplicity, the interval is bisected on the sign variations of
+     * the sequence instead. An interval collapses on its root if this is hit
+     * exactly. The clusters and the unresolved intervals are left as they
+     * are, and the latter are not within the tolerance.
+     * \param[in] qir Quadratic interval refiner.
+     * \param[in] verbose True if the function should print warnings.
+     * \return True if all the intervals are within the tolerance.
+     */
+    bool refine_intervals(const QIR<Real> &qir = QIR<Real>(),
+                          bool verbose         = false) {
+      return this->refine_intervals(this->m_result, qir, verbose);
+    }
+
+    /**
+     * \brief Shrink the intervals of a given result to certified brackets.
+     *
+     * Same as \c refine_intervals(qir, verbose), but on the intervals of a
+     * result of \c separate_roots(a, b, result).
+     * \param[in,out] result Result of the separation.
+     * \param[in] qir Quadratic interval refiner.
+     * \param[in] verbose True if the function should print warnings.
+     * \return True if all the intervals are within the tolerance.
+     */
+    bool refine_intervals(Result &result,
+                          const QIR<Real> &qir = QIR<Real>(),
+                          bool verbose         = false) const {
+      const Poly<Real, MaxDegree> &p{this->m_sequence[0]};
+      bool converged_all{true};
+      Integer n_intervals{static_cast<Integer>(result.intervals.size())};
+      for (Integer n{0}; n < n_intervals; ++n) {
+        Interval &I{result.intervals[n]};
+        if (I.unresolved) {
+          converged_all = false;
+          continue;
+        } else if (I.a_on_root || I.b_on_root || I.multiplicity > 1) {
+          continue;
+        }
+        Real fa{p.evaluate(I.a)}, fb{p.evaluate(I.b)};
+        bool converged{false};
+        if ((fa > 0 && fb < 0) || (fa < 0 && fb > 0)) {
+          converged = qir.bracket(I.a, I.b, fa, fb, p);
         } else {
-          converged = solve_function(I.a, I.b, function, r);
-          STURM_ASSERT_WARNING(
-              converged || !verbose,
-              "Sturm::Sequence::refine_roots(...): failed at interval n = "
-                  << n);
+          while (!(converged = I.b - I.a <= qir.tolerance(I.a, I.b))) {
+            Real c{(I.a + I.b) / 2};
+            if (!(c > I.a && c < I.b)) {
+              break;
+            }
+            bool c_on_root;
+            Integer vc{this->sign_variations(c, c_on_root)};
+            if (c_on_root) {
+              I.a = I.b = c;
+            } else if (vc != I.va) {
+              I.b  = c;
+              I.vb = vc;
+            } else {
+              I.a = c;
+            }
+          }
+        }
+        if (I.a == I.b) {
+          I.va        = I.vb;
+          I.a_on_root = I.b_on_root = true;
         }
+        STURM_ASSERT_WARNING(
+            converged || !verbose,
+            "Sturm::Sequence::refine_intervals(...): failed at interval n = "
+                << n + 1);
+        converged_all = converged_all && converged;
       }
-      return roots;
+      return converged_all;
     }
 
   };  // class Sequence
@@ -367,9 +1918,11 @@ namespace Sturm {
    * \param[in] s Sturm sequence.
    * \return The output stream.
    * \tparam Real Scalar number type.
+   * \tparam N Maximum degree of the polynomial.
    */
-  template <typename Real>
-  inline std::ostream &operator<<(std::ostream &os, const Sequence<Real> &s) {
+  template <typename Real, Integer N>
+  inline std::ostream &operator<<(std::ostream &os,
+                                  const Sequence<Real, N> &s) {
     // Print the Sturm sequence
     os << "Sturm sequence" << std::endl;
     for (Integer i{0}; i < s.length(); ++i) {
@@ -381,9 +1934,10 @@ namespace Sturm {
       os << "roots separation for interval [" << s.a() << "," << s.b() << "]"
          << std::endl;
       for (Integer i{0}; i < n; ++i) {
-        const typename Sequence<Real>::Interval &I = s.interval(i);
+        const typename Sequence<Real, N>::Interval &I = s.interval(i);
         os << "I = [" << I.a << ", " << I.b << "], V = [" << I.va << ", "
-           << I.vb << "]" << std::endl;
+           << I.vb << "]" << (I.unresolved ? " (unresolved)" : "")
+           << std::endl;
       }
     }
     return os;
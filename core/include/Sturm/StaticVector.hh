@@ -0,0 +1,226 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef INCLUDE_STURM_STATICVECTOR_HH
+#define INCLUDE_STURM_STATICVECTOR_HH
+
+#include "Sturm.hh"
+
+namespace Sturm {
+
+  /**
+   * \brief Fixed-capacity vector class.
+   *
+   * This class implements the subset of the \c std::vector interface used by
+   * the library on top of an in-place \c std::array, so that it never
+   * allocates on the heap.
+   * \tparam T Element type.
+   * \tparam N Capacity of the vector.
+   */
+  template <typename T, Integer N>
+  class StaticVector {
+   public:
+    using value_type     = T;         /**< Element type. */
+    using iterator       = T *;       /**< Iterator type. */
+    using const_iterator = const T *; /**< Constant iterator type. */
+
+   private:
+    std::array<T, N> m_data; /**< Elements storage. */
+    std::size_t m_size{0};   /**< Number of stored elements. */
+
+   public:
+    /**
+     * \brief Class constructor for the fixed-capacity vector.
+     */
+    StaticVector() {}
+
+    /**
+     * \brief Get the number of stored elements.
+     * \return The number of stored elements.
+     */
+    std::size_t size() const {
+      return this->m_size;
+    }
+
+    /**
+     * \brief Get the capacity of the vector.
+     * \return The capacity of the vector.
+     */
+    constexpr std::size_t capacity() const {
+      return N;
+    }
+
+    /**
+     * \brief Check if the vector is empty.
+     * \return True if the vector is empty.
+     */
+    bool empty() const {
+      return this->m_size == 0;
+    }
+
+    /**
+     * \brief Remove all the elements.
+     */
+    void clear() {
+      this->m_size = 0;
+    }
+
+    /**
+     * \brief Check that the vector can hold a given number of elements.
+     * \param[in] n Number of elements.
+     */
+    void reserve(std::size_t n) const {
+      STURM_ASSERT(n <= N,
+                   "Sturm::StaticVector::reserve(...): capacity " << N
+                       << " exceeded.");
+    }
+
+    /**
+     * \brief Replace the content with \f$ n \f$ copies of a value.
+     * \param[in] n Number of elements.
+     * \param[in] value Value to copy.
+     */
+    void assign(std::size_t n, const T &value) {
+      this->reserve(n);
+      std::fill_n(this->m_data.begin(), n, value);
+      this->m_size = n;
+    }
+
+    /**
+     * \brief Append a copy of an element.
+     * \param[in] value Element to append.
+     */
+    void push_back(const T &value) {
+      this->reserve(this->m_size + 1);
+      this->m_data[this->m_size++] = value;
+    }
+
+    /**
+     * \brief Append an element constructed from the given arguments.
+     * \param[in] args Arguments forwarded to the element constructor.
+     * \return Reference to the appended element.
+     */
+    template <typename... Args>
+    T &emplace_back(Args &&...args) {
+      this->reserve(this->m_size + 1);
+      T &value{this->m_data[this->m_size++]};
+      value = T(std::forward<Args>(args)...);
+      return value;
+    }
+
+    /**
+     * \brief Remove the last element.
+     */
+    void pop_back() {
+      --this->m_size;
+    }
+
+    /**
+     * \brief Access the last element.
+     * \return Reference to the last element.
+     */
+    T &back() {
+      return this->m_data[this->m_size - 1];
+    }
+
+    /**
+     * \brief Access the last element.
+     * \return Constant reference to the last element.
+     */
+    const T &back() const {
+      return this->m_data[this->m_size - 1];
+    }
+
+    /**
+     * \brief Access the \f$ i \f$-th element.
+     * \param[in] i Index of the element.
+     * \return Reference to the \f$ i \f$-th element.
+     */
+    T &operator[](std::size_t i) {
+      return this->m_data[i];
+    }
+
+    /**
+     * \brief Access the \f$ i \f$-th element.
+     * \param[in] i Index of the element.
+     * \return Constant reference to the \f$ i \f$-th element.
+     */
+    const T &operator[](std::size_t i) const {
+      return this->m_data[i];
+    }
+
+    /**
+     * \brief Get a pointer to the contiguous elements.
+     * \return Pointer to the first element.
+     */
+    T *data() {
+      return this->m_data.data();
+    }
+
+    /**
+     * \brief Get a constant pointer to the contiguous elements.
+     * \return Constant pointer to the first element.
+     */
+    const T *data() const {
+      return this->m_data.data();
+    }
+
+    /**
+     * \brief Get an iterator to the first element.
+     * \return Iterator to the first element.
+     */
+    iterator begin() {
+      return this->m_data.data();
+    }
+
+    /**
+     * \brief Get an iterator past the last element.
+     * \return Iterator past the last element.
+     */
+    iterator end() {
+      return this->m_data.data() + this->m_size;
+    }
+
+    /**
+     * \brief Get a constant iterator to the first element.
+     * \return Constant iterator to the first element.
+     */
+    const_iterator begin() const {
+      return this->m_data.data();
+    }
+
+    /**
+     * \brief Get a constant iterator past the last element.
+     * \return Constant iterator past the last element.
+     */
+    const_iterator end() const {
+      return this->m_data.data() + this->m_size;
+    }
+
+  };  // class StaticVector
+
+  /**
+   * \brief Container type selected by capacity.
+   *
+   * A \c std::vector when the capacity is \c Eigen::Dynamic, a heap-free \c
+   * StaticVector otherwise.
+   * \tparam T Element type.
+   * \tparam N Capacity of the container.
+   */
+  template <typename T, Integer N>
+  using Container = std::conditional_t<N == Eigen::Dynamic,
+                                       std::vector<T>,
+                                       StaticVector<T, N>>;
+
+}  // namespace Sturm
+
+#endif  // INCLUDE_STURM_STATICVECTOR_HH
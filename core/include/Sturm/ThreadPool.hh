@@ -0,0 +1,260 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef INCLUDE_STURM_THREADPOOL_HH
+#define INCLUDE_STURM_THREADPOOL_HH
+
+#include "Sturm.hh"
+
+namespace Sturm {
+
+  /**
+   * \brief Work-stealing thread pool.
+   *
+   * Each thread of the pool owns a double-ended task queue. Tasks pushed from
+   * a thread go to the back of its own queue, which the thread consumes in
+   * LIFO order, so that recursive subdivisions proceed depth-first. Idle
+   * threads steal from the front of the other queues, i.e., the oldest and
+   * typically largest tasks. The thread that waits for a set of tasks keeps
+   * executing queued tasks in the meantime, hence it counts as one of the
+   * threads of the pool and waiting from inside a task does not deadlock.
+   */
+  class ThreadPool {
+   public:
+    using Task = std::function<void()>; /**< Task type. */
+
+   private:
+    using Queue = struct Queue {
+      std::mutex mutex;       /**< Mutex guarding the queue. */
+      std::deque<Task> tasks; /**< Queued tasks. */
+    }; /**< Task queue of a thread. */
+
+    std::vector<std::unique_ptr<Queue>> m_queues; /**< Queues, the first one
+                                                     is shared by the threads
+                                                     outside the pool. */
+    std::vector<std::thread> m_workers;   /**< Worker threads. */
+    std::atomic<Integer> m_queued{0};     /**< Number of queued tasks. */
+    std::mutex m_mutex;                   /**< Mutex for the idle workers. */
+    std::condition_variable m_condition;  /**< Wakes up the idle workers. */
+    bool m_stop{false};                   /**< True when shutting down. */
+
+    inline static thread_local const ThreadPool *tl_pool{
+      nullptr}; /**< Pool owning the current thread. */
+    inline static thread_local Integer tl_index{
+      0}; /**< Queue index of the current thread. */
+
+    /**
+     * \brief Take a task, from the back of the own queue or from the front of
+     * another queue.
+     * \param[out] task Task taken.
+     * \return True if a task was found.
+     */
+    bool take(Task &task) {
+      Integer n_queues{static_cast<Integer>(this->m_queues.size())};
+      Integer i_own{this->thread_index()};
+      {
+        Queue &q{*this->m_queues[i_own]};
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (!q.tasks.empty()) {
+          task = std::move(q.tasks.back());
+          q.tasks.pop_back();
+          return true;
+        }
+      }
+      for (Integer k{1}; k < n_queues; ++k) {
+        Queue &q{*this->m_queues[(i_own + k) % n_queues]};
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (!q.tasks.empty()) {
+          task = std::move(q.tasks.front());
+          q.tasks.pop_front();
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /**
+     * \brief Main loop of a worker thread.
+     * \param[in] i Queue index of the worker.
+     */
+    void work(Integer i) {
+      tl_pool  = this;
+      tl_index = i;
+      while (true) {
+        if (this->run_one()) {
+          continue;
+        }
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+        this->m_condition.wait(lock, [this]() {
+          return this->m_stop || this->m_queued.load() > 0;
+        });
+        if (this->m_stop && this->m_queued.load() == 0) {
+          return;
+        }
+      }
+    }
+
+   public:
+    /**
+     * \brief Class constructor for the thread pool.
+     *
+     * The calling thread takes part in the work while waiting, so that only
+     * \f$ n - 1 \f$ worker threads are started. With a single thread, all the
+     * tasks run serially on the waiting thread.
+     * \param[in] n_threads Number of threads, including the waiting one (if
+     * non-positive, the number of hardware threads).
+     */
+    explicit ThreadPool(Integer n_threads = 0) {
+      if (n_threads <= 0) {
+        n_threads = static_cast<Integer>(std::thread::hardware_concurrency());
+      }
+      n_threads = std::max(n_threads, Integer(1));
+      for (Integer i{0}; i < n_threads; ++i) {
+        this->m_queues.push_back(std::make_unique<Queue>());
+      }
+      for (Integer i{1}; i < n_threads; ++i) {
+        this->m_workers.emplace_back([this, i]() { this->work(i); });
+      }
+    }
+
+    /**
+     * \brief Class destructor for the thread pool, which completes the queued
+     * tasks and joins the workers.
+     */
+    ~ThreadPool() {
+      {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_stop = true;
+      }
+      this->m_condition.notify_all();
+      for (std::thread &worker : this->m_workers) {
+        worker.join();
+      }
+    }
+
+    ThreadPool(const ThreadPool &)            = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * \brief Get the number of threads, including the waiting one.
+     * \return The number of threads.
+     */
+    Integer size() const {
+      return static_cast<Integer>(this->m_queues.size());
+    }
+
+    /**
+     * \brief Get the index of the current thread within the pool.
+     *
+     * The worker threads have indices \f$ 1, 2, \ldots, n - 1 \f$, while all
+     * the threads outside the pool share the index 0.
+     * \return The index of the current thread.
+     */
+    Integer thread_index() const {
+      return tl_pool == this ? tl_index : 0;
+    }
+
+    /**
+     * \brief Queue a task on the queue of the current thread.
+     * \param[in] task Task to queue.
+     */
+    void push(Task task) {
+      {
+        Queue &q{*this->m_queues[this->thread_index()]};
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.tasks.push_back(std::move(task));
+      }
+      {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        ++this->m_queued;
+      }
+      this->m_condition.notify_one();
+    }
+
+    /**
+     * \brief Run a single queued task, if any.
+     * \return True if a task was run.
+     */
+    bool run_one() {
+      Task task;
+      if (!this->take(task)) {
+        return false;
+      }
+      --this->m_queued;
+      task();
+      return true;
+    }
+
+    /**
+     * \brief Run the queued tasks until a condition is met.
+     * \param[in] done Condition to wait for.
+     * \tparam Condition Callable with the signature `bool()`.
+     */
+    template <typename Condition>
+    void wait_until(Condition &&done) {
+      while (!done()) {
+        if (!this->run_one()) {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    /**
+     * \brief Call a function for the indices \f$ 0, 1, \ldots, n - 1 \f$ in
+     * parallel.
+     *
+     * The indices are handed out one at a time from a shared counter, so that
+     * uneven workloads are balanced. The first exception thrown by the
+     * function is rethrown after all the running calls have returned.
+     * \param[in] n Number of indices.
+     * \param[in] function Function to call.
+     * \tparam Function Callable with the signature `void(Integer i)`.
+     */
+    template <typename Function>
+    void parallel_for(Integer n, Function &&function) {
+      Integer n_tasks{std::min(this->size(), n)};
+      if (n_tasks <= 0) {
+        return;
+      }
+      std::atomic<Integer> next{0};
+      std::atomic<Integer> pending{n_tasks};
+      std::exception_ptr error;
+      std::mutex error_mutex;
+      auto task = [&]() {
+        try {
+          for (Integer i{next++}; i < n; i = next++) {
+            function(i);
+          }
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if (!error) {
+            error = std::current_exception();
+          }
+          next = n;
+        }
+        --pending;
+      };
+      for (Integer k{1}; k < n_tasks; ++k) {
+        this->push(task);
+      }
+      task();
+      this->wait_until([&]() { return pending.load() == 0; });
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+
+  };  // class ThreadPool
+
+}  // namespace Sturm
+
+#endif  // INCLUDE_STURM_THREADPOOL_HH
@@ -0,0 +1,177 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/BatchSolver.hh"
+
+// Google Test
+#include <gtest/gtest.h>
+
+using namespace Sturm;
+
+// Bisection lambda function for the root solver with the signature `bool(Real
+// a, Real b, std::function<Real(Real)> f, Real & x)`
+template <typename Real>
+auto Bisection = [](Real a, Real b, std::function<Real(Real)> f, Real &x) {
+  Real fa{f(a)};
+  for (int i{0}; i < 1000; ++i) {
+    x = (a + b) / 2;
+    if (x <= a || x >= b) {
+      return true;
+    }
+    Real fx{f(x)};
+    if (fx == 0) {
+      return true;
+    }
+    if ((fa < 0) == (fx < 0)) {
+      a  = x;
+      fa = fx;
+    } else {
+      b = x;
+    }
+  }
+  return false;
+};
+
+template <typename T>
+class BatchTest : public ::testing::Test {};
+
+using TestTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(BatchTest, TestTypes);
+
+TYPED_TEST(BatchTest, Solve) {
+  using T = TypeParam;
+
+  // p_i(x) = prod_j (x - r_ij) with d_i = i % 5 roots r_ij = (j + 1) / (i + 1)
+  // and a complex pair for odd i, plus a constant and a zero polynomial
+  constexpr int n_poly{200};
+  std::vector<Poly<T>> polys;
+  Poly<T> f(2), g(3);
+  g << 1.0, 0.0, 1.0;
+  for (int i{0}; i < n_poly; ++i) {
+    Poly<T> p(1);
+    p << 1.0;
+    for (int j{0}; j < i % 5; ++j) {
+      f << -static_cast<T>(j + 1) / static_cast<T>(i + 1), 1.0;
+      p *= f;
+    }
+    if (i % 2 == 1) {
+      p *= g;
+    }
+    polys.push_back(p);
+  }
+  polys.push_back(Poly<T>(3));
+
+  typename BatchSolver<T>::Matrix coeffs(7, polys.size());
+  std::vector<Integer> degrees(polys.size());
+  coeffs.setZero();
+  for (std::size_t i{0}; i < polys.size(); ++i) {
+    degrees[i] = polys[i].degree();
+    coeffs.col(i).head(polys[i].order()) = polys[i].coeffs();
+  }
+
+  ThreadPool pool(3);
+  BatchSolver<T> solver(pool, 7);
+  for (bool matrix : {false, true}) {
+    int n_roots{matrix ? solver.solve(coeffs, degrees, Bisection<T>)
+                       : solver.solve(polys, Bisection<T>)};
+    EXPECT_EQ(solver.size(), n_poly + 1);
+    EXPECT_EQ(n_roots, 2 * n_poly);
+    EXPECT_EQ(solver.failures(), 0);
+    EXPECT_EQ(solver.offsets()[0], 0);
+    EXPECT_EQ(solver.offsets()[n_poly + 1], n_roots);
+    for (int i{0}; i < n_poly; ++i) {
+      std::span<const T> roots{solver.roots(i)};
+      ASSERT_EQ(static_cast<int>(roots.size()), i % 5);
+      for (int j{0}; j < i % 5; ++j) {
+        EXPECT_NEAR(roots[j],
+                    static_cast<T>(j + 1) / static_cast<T>(i + 1),
+                    static_cast<T>(1.0e-4));
+      }
+    }
+    EXPECT_TRUE(solver.roots(n_poly).empty());
+  }
+}
+
+TYPED_TEST(BatchTest, SharedPool) {
+  using T = TypeParam;
+
+  // p_i(x) = (x - 1/(i + 2))(x - 1)(x - 2), with a built-in refiner
+  constexpr int n_poly{100};
+  std::vector<Poly<T>> polys;
+  Poly<T> f(2);
+  for (int i{0}; i < n_poly; ++i) {
+    Poly<T> p(1);
+    p << 1.0;
+    for (T r : {T(1.0) / static_cast<T>(i + 2), T(1.0), T(2.0)}) {
+      f << -r, 1.0;
+      p *= f;
+    }
+    polys.push_back(p);
+  }
+
+  // Two solvers on the same pool, called at once by two threads outside the
+  // pool, which may run each other's chunks while waiting
+  ThreadPool pool(3);
+  BatchSolver<T> solver_1(pool, 3), solver_2(pool, 5);
+  for (int k{0}; k < 10; ++k) {
+    int n_roots_1{0}, n_roots_2{0};
+    std::thread thread_1(
+        [&]() { n_roots_1 = solver_1.solve(polys, Brent<T>()); });
+    std::thread thread_2(
+        [&]() { n_roots_2 = solver_2.solve(polys, Bisection<T>); });
+    thread_1.join();
+    thread_2.join();
+    EXPECT_EQ(n_roots_1, 3 * n_poly);
+    EXPECT_EQ(n_roots_2, 3 * n_poly);
+    for (const BatchSolver<T> *solver : {&solver_1, &solver_2}) {
+      EXPECT_EQ(solver->failures(), 0);
+      for (int i{0}; i < n_poly; ++i) {
+        std::span<const T> roots{solver->roots(i)};
+        ASSERT_EQ(roots.size(), 3u);
+        EXPECT_NEAR(roots[0],
+                    T(1.0) / static_cast<T>(i + 2),
+                    static_cast<T>(1.0e-4));
+        EXPECT_NEAR(roots[1], T(1.0), static_cast<T>(1.0e-4));
+        EXPECT_NEAR(roots[2], T(2.0), static_cast<T>(1.0e-4));
+      }
+    }
+  }
+}
+
+TYPED_TEST(BatchTest, Clusters) {
+  using T = TypeParam;
+
+  // p(x) = (x - c)(x - c - d)(x + 2), with two roots closer than the accuracy
+  // of a double root, where the bisection points from the root bounds miss
+  // them, since a root at a bisection point splits the cluster
+  bool single{std::is_same_v<T, float>};
+  T c{single ? T(1.5) : T(0.5)};
+  T d{single ? T(1.0e-4) : T(std::ldexp(1.0, -30))};
+  Poly<T> p(1), f(2);
+  p << 1.0;
+  for (T r : {c, c + d, T(-2.0)}) {
+    f << -r, 1.0;
+    p *= f;
+  }
+  std::vector<Poly<T>> polys{p};
+
+  // A cluster is reported once per real root, at its centre
+  ThreadPool pool(2);
+  BatchSolver<T> solver(pool);
+  EXPECT_FALSE(solver.cluster_detection());
+  solver.set_cluster_detection(true);
+  EXPECT_TRUE(solver.cluster_detection());
+  ASSERT_EQ(solver.solve(polys, Bisection<T>), 3);
+  std::span<const T> roots{solver.roots(0)};
+  EXPECT_NEAR(roots[0], T(-2.0), T(1.0e-4));
+  EXPECT_NEAR(roots[1], c, T(0.1));
+  EXPECT_EQ(roots[1], roots[2]);
+}
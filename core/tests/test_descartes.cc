@@ -0,0 +1,146 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/Descartes.hh"
+
+// Google Test
+#include <gtest/gtest.h>
+
+// C++ standard libraries
+#include <random>
+
+using namespace Sturm;
+
+template <typename T>
+class DescartesTest : public ::testing::Test {};
+
+using TestTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(DescartesTest, TestTypes);
+
+TYPED_TEST(DescartesTest, Roots) {
+  using T = TypeParam;
+
+  // p(x) = x^2 (x - 1) (x + 1/2) (x - 3/4), with roots on the bounds and on
+  // the bisection midpoints of [-1, 1]
+  Poly<T> p(1), f(2);
+  p << 1.0;
+  for (T r : {0.0, 0.0, 1.0, -0.5, 0.75}) {
+    f << -r, 1.0;
+    p *= f;
+  }
+
+  Descartes<T> des(p);
+  EXPECT_EQ(des.polynomial().degree(), 4);
+  EXPECT_EQ(des.separate_roots(-1.0, 1.0), 4);
+  EXPECT_EQ(des.separate_roots(0.1, 0.9), 1);
+  EXPECT_EQ(des.separate_roots(2.0, 3.0), 0);
+  EXPECT_EQ(des.separate_roots(), 4);
+
+  std::vector<T> expected{-0.5, 0.0, 0.75, 1.0};
+  typename Descartes<T>::Vector roots{des.refine_roots(Newton<T>(), true)};
+  ASSERT_EQ(roots.size(), 4);
+  for (int i{0}; i < roots.size(); ++i) {
+    EXPECT_NEAR(roots(i), expected[i], std::sqrt(Poly<T>::EPSILON));
+  }
+}
+
+TYPED_TEST(DescartesTest, Sequence) {
+  using T = TypeParam;
+
+  // Random polynomials, compared with the Sturm sequence
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<T> dist(-1.0, 1.0);
+  for (int degree : {3, 8, 15}) {
+    for (int k{0}; k < 50; ++k) {
+      Poly<T> p(degree + 1);
+      for (int j{0}; j <= degree; ++j) {
+        p.coeffRef(j) = dist(gen);
+      }
+      Sequence<T> seq(p);
+      Descartes<T> des(p);
+      int n_roots{seq.separate_roots()};
+      ASSERT_EQ(des.separate_roots(), n_roots);
+      typename Sequence<T>::Vector r_seq{seq.refine_roots(Brent<T>())};
+      typename Descartes<T>::Vector r_des{des.refine_roots(Brent<T>())};
+      for (int i{0}; i < n_roots; ++i) {
+        EXPECT_NEAR(r_seq(i), r_des(i), std::sqrt(Poly<T>::EPSILON));
+      }
+    }
+  }
+}
+
+TYPED_TEST(DescartesTest, SplitPoints) {
+  using T = TypeParam;
+
+  // Roots on or within the rounding errors of the splitting points -1, 0, 1
+  // and of the bisection midpoints, each of which must be found once
+  std::vector<std::vector<T>> cases{
+    {-1.0, -0.75, 0.3},
+    {0.25, 1.0, 1.5, 2.15},
+    {-1.5, -1.0, -0.75, -0.3, 0.0, 0.1, 0.25, 0.5, 1.0, 1.25, 1.7, 2.15}};
+  // Random roots on a grid of eighths, some of them moved off by 1/1000
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> grid(-16, 16), off(0, 1);
+  for (int k{0}; k < 200; ++k) {
+    std::vector<int> g;
+    while (static_cast<int>(g.size()) < 3 + k % 6) {
+      int i{grid(gen)};
+      if (std::find(g.begin(), g.end(), i) == g.end()) {
+        g.push_back(i);
+      }
+    }
+    std::vector<T> r;
+    for (int i : g) {
+      r.push_back(static_cast<T>(i) / T(8.0) +
+                  static_cast<T>(off(gen)) / T(1000.0));
+    }
+    cases.push_back(r);
+  }
+  for (std::vector<T> &r : cases) {
+    Poly<T> p(1), f(2);
+    p << 1.0;
+    for (T x : r) {
+      f << -x, 1.0;
+      p *= f;
+    }
+    std::sort(r.begin(), r.end());
+    Descartes<T> des(p);
+    int n_roots{static_cast<int>(r.size())};
+    ASSERT_EQ(des.separate_roots(), n_roots);
+    // The rounded coefficients move the roots by a few ulps
+    T tol{std::sqrt(std::numeric_limits<T>::epsilon())};
+    for (int i{0}; i < n_roots; ++i) {
+      const typename Descartes<T>::Interval &I{des.interval(i)};
+      EXPECT_LE(I.a, r[i] + tol);
+      EXPECT_GE(I.b, r[i] - tol);
+    }
+  }
+}
+
+TEST(DescartesTest, Chebyshev) {
+  // T_n(x) has n simple roots cos((2k - 1) pi / (2n)) in (-1, 1)
+  Poly<double> t_0(1), t_1(2), x(2), t_2;
+  t_0 << 1.0;
+  t_1 << 0.0, 1.0;
+  x << 0.0, 2.0;
+  for (int n{2}; n <= 30; ++n) {
+    t_2 = x * t_1 - t_0;
+    t_0 = t_1;
+    t_1 = t_2;
+  }
+  Descartes<double> des(t_1);
+  ASSERT_EQ(des.separate_roots(), 30);
+  typename Descartes<double>::Vector roots{des.refine_roots(ITP<double>())};
+  for (int k{1}; k <= 30; ++k) {
+    EXPECT_NEAR(roots(30 - k), std::cos((2 * k - 1) * std::numbers::pi / 60),
+                1.0e-7);
+  }
+}
@@ -74,3 +74,89 @@ TYPED_TEST(DivisionTest, P2DivP1) {
   EXPECT_EQ(q.degree(), 0);
   EXPECT_EQ(r.degree(), 1);
 }
+
+TYPED_TEST(DivisionTest, Workspace) {
+  using T = TypeParam;
+
+  Poly<T> p1(3);
+  p1 << 1.0, -3.0, 2.0;
+  Poly<T> p2(3);
+  p2 << 0.0, 1.0, 1.0;
+  Poly<T> p3(5);
+  p3 << 1.0, 0.0, -2.0, 0.5, 1.0;
+
+  // The same workspace is reused for operands of different orders
+  DivideWorkspace<T> ws;
+  Poly<T> q, r, q_sol, r_sol;
+  for (auto [a, b] : {std::pair{&p1, &p2},
+                      std::pair{&p3, &p1},
+                      std::pair{&p2, &p3},
+                      std::pair{&p3, &p2}}) {
+    Sturm::divide<T>(*a, *b, q, r, ws);
+    Sturm::divide<T>(*a, *b, q_sol, r_sol);
+    EXPECT_EQ(q.order(), q_sol.order());
+    EXPECT_EQ(r.order(), r_sol.order());
+    EXPECT_TRUE(q.coeffs().isApprox(q_sol.coeffs()));
+    EXPECT_TRUE(r.coeffs().isApprox(r_sol.coeffs()));
+    for (T x : {T(-1.5), T(0.5), T(2.0)}) {
+      EXPECT_NEAR((*b * q + r).evaluate(x), a->evaluate(x), T(1.0e-4));
+    }
+  }
+}
+
+TYPED_TEST(DivisionTest, Newton) {
+  using T = TypeParam;
+
+  // Orders above STURM_NEWTON_DIVIDE_THRESHOLD, with a well conditioned
+  // divisor b(x) = 1/4 + x^(n_b-2) (1/2 + x)
+  Integer n_b{STURM_NEWTON_DIVIDE_THRESHOLD + 40}, n_q{2 * n_b};
+  Poly<T> b(n_b), q_sol(n_q), r_sol(n_b - 1);
+  b.setZero();
+  b.coeffRef(0)       = 0.25;
+  b.coeffRef(n_b - 2) = 0.5;
+  b.coeffRef(n_b - 1) = 1.0;
+  for (Integer i{0}; i < n_q; ++i) {
+    q_sol.coeffRef(i) = std::cos(T(i));
+  }
+  for (Integer i{0}; i < n_b - 1; ++i) {
+    r_sol.coeffRef(i) = std::sin(T(i));
+  }
+  Poly<T> a(b * q_sol + r_sol), q, r;
+
+  Sturm::divide<T>(a, b, q, r);
+  T tol{T(10.0) * n_b * Poly<T>::EPSILON};
+  EXPECT_EQ(q.order(), n_q);
+  EXPECT_EQ(r.order(), n_b - 1);
+  EXPECT_LT((q.coeffs() - q_sol.coeffs()).cwiseAbs().maxCoeff(), tol);
+  EXPECT_LT((r.coeffs() - r_sol.coeffs()).cwiseAbs().maxCoeff(), tol);
+
+  Divisor<T> div(b);
+  Sturm::divide<T>(a, div, q, r);
+  EXPECT_LT((q.coeffs() - q_sol.coeffs()).cwiseAbs().maxCoeff(), tol);
+  EXPECT_LT((r.coeffs() - r_sol.coeffs()).cwiseAbs().maxCoeff(), tol);
+}
+
+TYPED_TEST(DivisionTest, Divisor) {
+  using T = TypeParam;
+
+  Poly<T> p1(3);
+  p1 << 1.0, -3.0, 2.0;
+  Poly<T> p2(3);
+  p2 << 0.0, 1.0, 1.0;
+  Poly<T> p3(5);
+  p3 << 1.0, 0.0, -2.0, 0.5, 1.0;
+  Poly<T> p4(2);
+  p4 << 1.0, 3.0;
+
+  // One divisor for dividends of growing orders, and of lower order
+  Divisor<T> div(p1);
+  Poly<T> q, r, q_sol, r_sol;
+  for (Poly<T> *a : {&p2, &p3, &p4, &p1}) {
+    Sturm::divide<T>(*a, div, q, r);
+    Sturm::divide<T>(*a, p1, q_sol, r_sol);
+    EXPECT_EQ(q.order(), q_sol.order());
+    EXPECT_EQ(r.order(), r_sol.order());
+    EXPECT_TRUE(q.coeffs().isApprox(q_sol.coeffs()));
+    EXPECT_TRUE(r.coeffs().isApprox(r_sol.coeffs()));
+  }
+}
@@ -82,3 +82,29 @@ TYPED_TEST(GCDTest, NonTrivialGCD) {
   EXPECT_TRUE(gcd.coeffs().isApprox(sol_gcd));
   EXPECT_EQ(gcd.degree(), 1);
 }
+
+TYPED_TEST(GCDTest, Workspace) {
+  using T = TypeParam;
+
+  Poly<T> p5(3);
+  p5 << 1, -2, 1;
+  Poly<T> p6(2);
+  p6 << 1, -1;
+  Poly<T> p7(4);
+  p7 << -1, 1, -1, 1;  // (x - 1) * (x^2 + 1)
+
+  DivideWorkspace<T> ws;
+  Poly<T> gcd;
+
+  typename Poly<T>::Vector sol_gcd(2);
+  sol_gcd << 1, -1;
+
+  Sturm::GCD<T>(p5, p6, gcd, ws);
+  EXPECT_TRUE(gcd.coeffs().isApprox(sol_gcd));
+  EXPECT_EQ(gcd.degree(), 1);
+
+  Sturm::GCD<T>(p7, p5, gcd, ws);
+  EXPECT_TRUE(gcd.coeffs().isApprox(sol_gcd) ||
+              gcd.coeffs().isApprox(-sol_gcd));
+  EXPECT_EQ(gcd.degree(), 1);
+}
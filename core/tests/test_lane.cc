@@ -0,0 +1,160 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2026, Davide Stocco and Enrico Bertolazzi.                  *
+ *                                                                           *
+ * The Sturm project is distributed under the BSD 2-Clause License.          *
+ *                                                                           *
+ * Davide Stocco                                           Enrico Bertolazzi *
+ * University of Trento                                 University of Trento *
+ * davide.stocco@unitn.it                         enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Sturm library
+#include "Sturm/LaneSolver.hh"
+
+// Google Test
+#include <gtest/gtest.h>
+
+// C++ standard libraries
+#include <random>
+
+using namespace Sturm;
+
+template <typename T>
+class LaneTest : public ::testing::Test {};
+
+using TestTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(LaneTest, TestTypes);
+
+TYPED_TEST(LaneTest, Quintics) {
+  using T = TypeParam;
+
+  // p_i(x) = (x - r_0) ... (x - r_{k-1}) (x^2 + k^2) ... (x^2 + 9) with k = 1,
+  // 3, 5 real roots r_j = (j - 2) + i/100, plus a cubic with zero leading
+  // coefficients, which takes the scalar path
+  constexpr int n_poly{61};
+  std::vector<Poly<T, 5>> polys;
+  std::vector<std::vector<T>> expected;
+  Poly<T, 5> f(2), g(3);
+  for (int i{0}; i < n_poly; ++i) {
+    int k{1 + 2 * (i % 3)};
+    Poly<T, 5> p(1);
+    p << 1.0;
+    std::vector<T> r;
+    for (int j{0}; j < k; ++j) {
+      r.push_back(static_cast<T>(j - 2) + static_cast<T>(i) / 100);
+      f << -r.back(), 1.0;
+      p *= f;
+    }
+    for (int j{k}; j < 5; j += 2) {
+      g << static_cast<T>(j * j), 0.0, 1.0;
+      p *= g;
+    }
+    polys.push_back(p);
+    expected.push_back(r);
+  }
+  Poly<T, 5> p(6);
+  p << 0.1875, -0.6875, -0.5, 1.0, 0.0, 0.0;  // (x + 3/4)(x - 1/4)(x - 1)
+  polys.push_back(p);
+  expected.push_back({-0.75, 0.25, 1.0});
+
+  typename LaneSolver<T, 5>::Matrix coeffs(6, polys.size());
+  coeffs.setZero();
+  for (std::size_t i{0}; i < polys.size(); ++i) {
+    coeffs.col(i).head(polys[i].order()) = polys[i].coeffs();
+  }
+
+  LaneSolver<T, 5> solver;
+  for (bool matrix : {false, true}) {
+    int n_roots{matrix ? solver.solve(coeffs) : solver.solve(polys)};
+    EXPECT_EQ(solver.size(), static_cast<int>(polys.size()));
+    EXPECT_EQ(solver.fallbacks(), 1);
+    EXPECT_EQ(solver.failures(), 0);
+    EXPECT_EQ(solver.offsets().back(), n_roots);
+    for (std::size_t i{0}; i < polys.size(); ++i) {
+      std::span<const T> roots{solver.roots(i)};
+      ASSERT_EQ(roots.size(), expected[i].size());
+      for (std::size_t j{0}; j < roots.size(); ++j) {
+        EXPECT_NEAR(roots[j], expected[i][j], std::sqrt(Poly<T>::EPSILON));
+      }
+    }
+  }
+}
+
+TYPED_TEST(LaneTest, Cubics) {
+  using T = TypeParam;
+
+  // Random cubics, compared with the scalar Sturm sequence
+  constexpr int n_poly{1000};
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<T> dist(-1.0, 1.0);
+  std::vector<Poly<T, 3>> polys(n_poly, Poly<T, 3>(4));
+  for (Poly<T, 3> &p : polys) {
+    for (int j{0}; j < 4; ++j) {
+      p.coeffRef(j) = dist(gen);
+    }
+  }
+
+  LaneSolver<T, 3> solver;
+  solver.solve(polys);
+  EXPECT_EQ(solver.failures(), 0);
+  Sequence<T, 3> seq;
+  for (int i{0}; i < n_poly; ++i) {
+    seq.build(polys[i]);
+    ASSERT_EQ(static_cast<int>(solver.roots(i).size()), seq.separate_roots());
+    for (int j{0}; j < seq.roots_number(); ++j) {
+      T r{solver.roots(i)[j]};
+      EXPECT_GE(r, seq.interval(j).a);
+      EXPECT_LE(r, seq.interval(j).b);
+      // Residual within the rounding errors of the evaluation
+      T p_abs{0.0}, Dp_abs{0.0};
+      for (int k{3}; k >= 0; --k) {
+        Dp_abs = Dp_abs * std::abs(r) + p_abs;
+        p_abs  = p_abs * std::abs(r) + std::abs(polys[i].coeff(k));
+      }
+      EXPECT_LE(std::abs(polys[i].evaluate(r)),
+                10 * Poly<T>::EPSILON *
+                    (p_abs + Dp_abs * std::max(T(1.0), std::abs(r))));
+    }
+  }
+}
+
+TYPED_TEST(LaneTest, CloseRoots) {
+  using T = TypeParam;
+
+  // Quintics with two random roots and three roots s apart, whose Sturm
+  // sequences lose most of their accuracy, compared with the scalar Sturm
+  // sequence, plus a quintic whose rounded sequence gives counts that are not
+  // monotone in single precision
+  bool single{std::is_same_v<T, float>};
+  std::vector<T> spacings{single ? std::vector<T>{0.1, 0.01, 0.003}
+                                 : std::vector<T>{1.0e-3, 1.0e-4, 1.0e-5,
+                                                  1.0e-6}};
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<T> dist(-1.0, 1.0);
+  std::vector<Poly<T, 5>> polys;
+  Poly<T, 5> f(2);
+  for (T s : spacings) {
+    for (int i{0}; i < 500; ++i) {
+      T c{dist(gen)};
+      Poly<T, 5> p(1);
+      p << 1.0;
+      for (T r : {dist(gen), dist(gen), c, c + s, c + 2 * s}) {
+        f << -r, 1.0;
+        p *= f;
+      }
+      polys.push_back(p);
+    }
+  }
+  Poly<T, 5> p(6);
+  p << -0.0869719684, 0.778996527, -2.71426105, 4.54232168, -3.56802225, 1.0;
+  polys.push_back(p);
+
+  LaneSolver<T, 5> solver;
+  solver.solve(polys);
+  EXPECT_EQ(solver.failures(), 0);
+  Sequence<T, 5> seq;
+  for (std::size_t i{0}; i < polys.size(); ++i) {
+    seq.build(polys[i]);
+    EXPECT_EQ(static_cast<int>(solver.roots(i).size()), seq.separate_roots());
+  }
+}
@@ -85,6 +85,68 @@ TYPED_TEST(PolyTest, Multiplication) {
   EXPECT_EQ(mul.order(), 5);
 }
 
+TYPED_TEST(PolyTest, HighOrderMultiplication) {
+  using T = TypeParam;
+
+  // Every engine against the schoolbook product, balanced and not
+  for (Integer n_1 : {40, 300, 700}) {
+    for (Integer n_2 : {1, 40, 300}) {
+      Poly<T> p1(n_1), p2(n_2), sol(n_1 + n_2 - 1);
+      for (Integer i{0}; i < n_1; ++i) {
+        p1.coeffRef(i) = std::cos(T(i));
+      }
+      for (Integer i{0}; i < n_2; ++i) {
+        p2.coeffRef(i) = std::sin(T(i + 1));
+      }
+      Sturm::multiply_schoolbook(
+          p1.data(), n_1, p2.data(), n_2, sol.data());
+
+      Poly<T> mul(p1 * p2), mul_assign(p1), mul_kara(sol), mul_fft(sol);
+      mul_assign *= p2;
+      Sturm::multiply_karatsuba(
+          p1.data(), n_1, p2.data(), n_2, mul_kara.data());
+      Sturm::multiply_fft(p1.data(), n_1, p2.data(), n_2, mul_fft.data());
+      // Unit-bounded coefficients, the FFT error scales with |a|_2 |b|_2
+      T tol{T(100.0) * std::numeric_limits<T>::epsilon() *
+            std::sqrt(T(n_1 * n_2))};
+      EXPECT_EQ(mul.order(), n_1 + n_2 - 1);
+      EXPECT_LT((mul.coeffs() - sol.coeffs()).cwiseAbs().maxCoeff(), tol);
+      EXPECT_LT((mul_assign.coeffs() - sol.coeffs()).cwiseAbs().maxCoeff(),
+                tol);
+      EXPECT_LT((mul_kara.coeffs() - sol.coeffs()).cwiseAbs().maxCoeff(), tol);
+      EXPECT_LT((mul_fft.coeffs() - sol.coeffs()).cwiseAbs().maxCoeff(), tol);
+    }
+  }
+
+  // Self-multiplication aliases both operands
+  Poly<T> p(3), sol(5);
+  p << 1.0, -3.0, 2.0;
+  sol << 1.0, -6.0, 13.0, -12.0, 4.0;
+  p *= p;
+  EXPECT_TRUE(p.coeffs().isApprox(sol.coeffs()));
+}
+
+TYPED_TEST(PolyTest, FixedDegreeArithmetic) {
+  using T = TypeParam;
+
+  Poly<T, 4> p1(3);
+  p1 << 1.0, -3.0, 2.0;
+  Poly<T, 4> p2(3);
+  p2 << 0.0, 1.0, 1.0;
+
+  Poly<T, 4> sum(p1 + p2), mul(p1 * p2), q, r;
+  Sturm::divide<T>(mul, p2, q, r);
+
+  typename Poly<T, 4>::Vector sol_sum(3), sol_mul(5);
+  sol_sum << 1.0, -2.0, 3.0;
+  sol_mul << 0.0, 1.0, -2.0, -1.0, 2.0;
+
+  EXPECT_TRUE(sum.coeffs().isApprox(sol_sum));
+  EXPECT_TRUE(mul.coeffs().isApprox(sol_mul));
+  EXPECT_TRUE(q.coeffs().isApprox(p1.coeffs()));
+  EXPECT_EQ(r.order(), 0);
+}
+
 // ---------------------- Evaluation ----------------------
 TYPED_TEST(PolyTest, Evaluation) {
   using T = TypeParam;
@@ -101,6 +163,86 @@ TYPED_TEST(PolyTest, Evaluation) {
   EXPECT_LT(std::abs(eval2 - T(6.0)), std::numeric_limits<T>::epsilon());
 }
 
+// ---------------------- Batched evaluation ----------------------
+TYPED_TEST(PolyTest, BatchEvaluation) {
+  using T = TypeParam;
+
+  Poly<T> p1(4);
+  p1 << 1.0, -3.0, 2.0, 0.5;
+
+  // More points than a block, to exercise the tail of the last block
+  std::vector<T> x(Poly<T>::BLOCK_SIZE + 37), p(x.size()), Dp(x.size());
+  for (std::size_t i{0}; i < x.size(); ++i) {
+    x[i] = T(-2.0) + T(4.0) * T(i) / T(x.size());
+  }
+
+  p1.evaluate(x, p);
+  for (std::size_t i{0}; i < x.size(); ++i) {
+    EXPECT_NEAR(p[i], p1.evaluate(x[i]), T(1.0e-5));
+  }
+
+  p1.evaluate(x, p, Dp);
+  for (std::size_t i{0}; i < x.size(); ++i) {
+    EXPECT_NEAR(p[i], p1.evaluate(x[i]), T(1.0e-5));
+    EXPECT_NEAR(Dp[i], p1.evaluate_derivative(x[i]), T(1.0e-5));
+  }
+}
+
+// ---------------------- Compensated evaluation ----------------------
+TYPED_TEST(PolyTest, CompensatedEvaluation) {
+  using T = TypeParam;
+
+  // p(x) = (x - 1)^7 expanded, with exact coefficients and cancellation near
+  // the root, where x - 1 is exact and its power is taken in long double
+  Poly<T> p(1), f(2);
+  p << 1.0;
+  f << -1.0, 1.0;
+  for (Integer i{0}; i < 7; ++i) {
+    p = p * f;
+  }
+
+  T native_error{0.0}, compensated_error{0.0};
+  for (Integer k{-16}; k <= 16; ++k) {
+    T x{T(1.0) + T(k) / T(1000.0)};
+    long double exact{std::pow(static_cast<long double>(x - T(1.0)), 7)};
+    T error;
+    T value{p.evaluate_compensated(x, error)};
+    EXPECT_LE(std::abs(value - exact), error);
+    native_error = std::max(native_error, T(std::abs(p.evaluate(x) - exact)));
+    compensated_error = std::max(compensated_error, T(std::abs(value - exact)));
+  }
+  EXPECT_LT(compensated_error, native_error);
+}
+
+// ---------------------- Evaluation strategies ----------------------
+TYPED_TEST(PolyTest, EvaluationStrategies) {
+  using T = TypeParam;
+
+  // p(x) = (x - 1)^7 expanded, as in the compensated evaluation test
+  Poly<T> p(1), f(2);
+  p << 1.0;
+  f << -1.0, 1.0;
+  for (Integer i{0}; i < 7; ++i) {
+    p = p * f;
+  }
+
+  T native_error{0.0}, double_double_error{0.0};
+  for (Integer k{-16}; k <= 16; ++k) {
+    T x{T(1.0) + T(k) / T(1000.0)};
+    long double exact{std::pow(static_cast<long double>(x - T(1.0)), 7)};
+    T error;
+    T compensated{p.evaluate_compensated(x, error)};
+    T double_double{p.evaluate(x, Evaluation::DOUBLE_DOUBLE)};
+    EXPECT_EQ(p.evaluate(x, Evaluation::NATIVE), p.evaluate(x));
+    EXPECT_EQ(p.evaluate(x, Evaluation::COMPENSATED), compensated);
+    EXPECT_LE(std::abs(double_double - exact), 2 * error);
+    native_error = std::max(native_error, T(std::abs(p.evaluate(x) - exact)));
+    double_double_error =
+        std::max(double_double_error, T(std::abs(double_double - exact)));
+  }
+  EXPECT_LT(double_double_error, native_error);
+}
+
 // ---------------------- Differentiation ----------------------
 TYPED_TEST(PolyTest, Differentiation) {
   using T = TypeParam;
@@ -155,3 +297,103 @@ TYPED_TEST(PolyTest, IntegrationWithConstant) {
   EXPECT_EQ(integ.degree(), 3);
   EXPECT_EQ(integ.order(), 4);
 }
+
+// ---------------------- Root bounds ----------------------
+TYPED_TEST(PolyTest, RootBounds) {
+  using T = TypeParam;
+
+  // 10^-3 (x + 30)(x - 5)(x - 10)(x - 20), with badly scaled coefficients
+  Poly<T> p1(5);
+  p1 << -30.0, 9.5, -0.7, -5.0e-3, 1.0e-3;
+  EXPECT_GE(p1.cauchy_bound(), T(30.0));
+  EXPECT_GE(p1.fujiwara_bound(), T(30.0));
+  EXPECT_GE(p1.lagrange_bound(), T(30.0));
+  EXPECT_GE(p1.kioustelidis_bound(), T(20.0));
+  EXPECT_GE(p1.kioustelidis_bound(true), T(30.0));
+  EXPECT_GE(p1.local_max_bound(), T(20.0));
+  EXPECT_GE(p1.local_max_bound(true), T(30.0));
+  EXPECT_LE(p1.local_max_bound(), p1.kioustelidis_bound());
+
+  T a, b;
+  p1.root_bounds(a, b);
+  EXPECT_LE(a, T(-30.0));
+  EXPECT_GE(b, T(20.0));
+  EXPECT_LT(b - a, 2 * p1.cauchy_bound());
+
+  // (x + 3)(x - 1/2)(x - 1)(x - 2), with well scaled coefficients, gets the
+  // Cauchy bound on both sides
+  Poly<T> p4(5);
+  p4 << -3.0, 9.5, -7.0, -0.5, 1.0;
+  p4.root_bounds(a, b);
+  EXPECT_EQ(a, -p4.cauchy_bound());
+  EXPECT_EQ(b, p4.cauchy_bound());
+
+  // (x + 1)(x + 100) has no positive roots
+  Poly<T> p2(3);
+  p2 << 100.0, 101.0, 1.0;
+  p2.root_bounds(a, b);
+  EXPECT_LE(a, T(-100.0));
+  EXPECT_EQ(b, T(0.0));
+
+  // x - 100 has a root on Fujiwara's bound
+  Poly<T> p3(2);
+  p3 << -100.0, 1.0;
+  p3.root_bounds(a, b);
+  EXPECT_EQ(a, T(0.0));
+  EXPECT_GT(b, T(100.0));
+}
+
+TYPED_TEST(PolyTest, Mobius) {
+  using T = TypeParam;
+
+  // (x + 3)(x - 1/2)(x - 1)(x - 2)
+  Poly<T> p(5), q;
+  p << -3.0, 9.5, -7.0, -0.5, 1.0;
+  p.mobius(0.0, 3.0, q);
+  EXPECT_EQ(q.order(), p.order());
+  EXPECT_GE(q.sign_variations(), 3);
+  p.mobius(0.75, 1.5, q);
+  EXPECT_EQ(q.sign_variations(), 1);
+  p.mobius(-2.0, 0.25, q);
+  EXPECT_EQ(q.sign_variations(), 0);
+  p.mobius(-4.0, -2.0, q);
+  EXPECT_EQ(q.sign_variations(), 1);
+
+  // The map is (x + 1)^n p((a x + b)/(x + 1)), up to a positive scaling
+  p.mobius(0.75, 1.5, q);
+  T s{q.evaluate(1.0) / (16 * p.evaluate(1.125))};
+  EXPECT_GT(s, T(0.0));
+  EXPECT_NEAR(q.evaluate(3.0) / s, 256 * p.evaluate(0.9375), 1.0e-2);
+
+  // Same map, up to a power of two, with the magnitudes of the terms
+  Poly<T> q_m, m;
+  for (T a : {T(-4.0), T(0.0), T(0.75)}) {
+    p.mobius(a, a + 1, q);
+    p.mobius(a, a + 1, q_m, m);
+    EXPECT_EQ(q_m.sign_variations(), q.sign_variations());
+    EXPECT_TRUE(
+        (q_m.coeffs() / q_m.coeff(4)).isApprox(q.coeffs() / q.coeff(4)));
+    for (Integer i{0}; i < q.order(); ++i) {
+      EXPECT_GE(m.coeff(i), std::abs(q_m.coeff(i)));
+    }
+  }
+}
+
+TYPED_TEST(PolyTest, Pellet) {
+  using T = TypeParam;
+
+  // (x - 1/2)(x - 17/32)(x - 3)
+  Poly<T> p(4), g, m;
+  p << -0.796875, 3.359375, -4.03125, 1.0;
+  EXPECT_EQ(p.pellet(0.25, 0.75, g, m), 2);
+  EXPECT_EQ(p.pellet(-0.1, 0.1, g, m), 0);
+  EXPECT_EQ(p.pellet(2.5, 3.5, g, m), 1);
+  EXPECT_EQ(p.pellet(-10.0, 10.0, g, m), 3);
+  // Root on the boundary of the disc
+  EXPECT_EQ(p.pellet(0.0, 0.5, g, m), -1);
+
+  // (x^2 + 1/64)(x - 2), the complex roots are counted as well
+  Poly<T> q(4);
+  q << -0.03125, 0.015625, -2.0, 1.0;
+  EXPECT_EQ(q.pellet(-0.5, 0.5, g, m), 2);
+}
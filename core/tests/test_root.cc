@@ -107,3 +107,160 @@ TYPED_TEST(RootTest, Test2) {
     EXPECT_LT(std::abs(p.evaluate(roots(i))), static_cast<T>(1.0e-5));
   }
 }
+
+TYPED_TEST(RootTest, Parallel) {
+  using T = TypeParam;
+
+  // p(x) = (x^2 - 1) prod_i (x - (2i - 13)/12), with roots on the bisection
+  // midpoints of [-1.5, 1.5] and [-2, 2] as well
+  Poly<T> p(1), f(2);
+  p << 1.0;
+  for (int i{1}; i <= 12; ++i) {
+    f << -static_cast<T>(2 * i - 13) / static_cast<T>(12.0), 1.0;
+    p *= f;
+  }
+  Poly<T> g(3);
+  g << -1.0, 0.0, 1.0;
+  p *= g;
+
+  Sequence<T> seq_serial(p), seq_parallel(p);
+  ThreadPool pool(4);
+  for (T b : {static_cast<T>(1.5), static_cast<T>(2.0)}) {
+    int n_serial{seq_serial.separate_roots(-b, b)};
+    int n_parallel{seq_parallel.separate_roots(-b, b, pool)};
+    EXPECT_EQ(n_serial, 14);
+    ASSERT_EQ(n_serial, n_parallel);
+    for (int i{0}; i < n_serial; ++i) {
+      EXPECT_EQ(seq_serial.interval(i).a, seq_parallel.interval(i).a);
+      EXPECT_EQ(seq_serial.interval(i).b, seq_parallel.interval(i).b);
+    }
+
+    typename Poly<T>::Vector roots_serial = seq_serial.refine_roots(Secant<T>);
+    typename Poly<T>::Vector roots_parallel =
+        seq_parallel.refine_roots(Secant<T>, pool);
+    ASSERT_EQ(roots_serial.size(), roots_parallel.size());
+    for (int i{0}; i < roots_serial.size(); ++i) {
+      EXPECT_EQ(roots_serial(i), roots_parallel(i));
+    }
+
+    // The parallel refinement stores the roots in the result, as the serial
+    // one does, and refines the intervals of a given result as well
+    typename Sequence<T>::Result result, result_serial;
+    EXPECT_EQ(seq_serial.separate_roots(-b, b, result), n_serial);
+    EXPECT_EQ(seq_serial.separate_roots(-b, b, result_serial), n_serial);
+    EXPECT_EQ(seq_serial.refine_roots(Secant<T>, result, pool),
+              seq_serial.refine_roots(Secant<T>, result_serial));
+    ASSERT_EQ(seq_parallel.result().roots.size(), roots_serial.size());
+    ASSERT_EQ(result.roots.size(), roots_serial.size());
+    for (int i{0}; i < roots_serial.size(); ++i) {
+      EXPECT_EQ(seq_parallel.result().roots(i), roots_serial(i));
+      EXPECT_EQ(result.roots(i), roots_serial(i));
+    }
+  }
+
+  // A fixed-degree sequence separates the roots in parallel as well
+  Poly<T, 14> p_fixed(p.order());
+  for (int j{0}; j < p.order(); ++j) {
+    p_fixed.coeffRef(j) = p.coeff(j);
+  }
+  Sequence<T, 14> seq_fixed(p_fixed);
+  int n_fixed{seq_fixed.separate_roots(-2.0, 2.0, pool)};
+  ASSERT_EQ(n_fixed, seq_serial.separate_roots(-2.0, 2.0));
+  for (int i{0}; i < n_fixed; ++i) {
+    EXPECT_EQ(seq_fixed.interval(i).a, seq_serial.interval(i).a);
+    EXPECT_EQ(seq_fixed.interval(i).b, seq_serial.interval(i).b);
+  }
+}
+
+TYPED_TEST(RootTest, Refiners) {
+  using T = TypeParam;
+
+  // p(x) = prod_i (x - r_i) with r_i = (2i - 9)/7, plus a root near zero
+  Poly<T> p(1), f(2);
+  p << 1.0;
+  std::vector<T> r;
+  for (int i{0}; i < 10; ++i) {
+    r.push_back(i == 5 ? static_cast<T>(1.0e-3)
+                       : static_cast<T>(2 * i - 9) / static_cast<T>(7.0));
+    f << -r.back(), 1.0;
+    p *= f;
+  }
+  std::sort(r.begin(), r.end());
+
+  Sequence<T> seq(p);
+  ASSERT_EQ(seq.separate_roots(), 10);
+  Tolerance<T> tolerance;
+  tolerance.ulps = 8;
+  auto check = [&](const typename Poly<T>::Vector &roots) {
+    ASSERT_EQ(roots.size(), 10);
+    for (int i{0}; i < roots.size(); ++i) {
+      EXPECT_NEAR(roots(i), r[i], 1000 * Poly<T>::EPSILON);
+    }
+  };
+  check(seq.refine_roots(Newton<T>(tolerance), true));
+  check(seq.refine_roots(Brent<T>(tolerance), true));
+  check(seq.refine_roots(ITP<T>(tolerance), true));
+
+  // Loose absolute tolerance
+  tolerance.absolute = 1.0e-3;
+  for (int i{0}; i < seq.roots_number(); ++i) {
+    const typename Sequence<T>::Interval &I{seq.interval(i)};
+    T x_newton, x_brent, x_itp;
+    EXPECT_TRUE(Newton<T>(tolerance).solve(I.a, I.b, seq.get(0), x_newton));
+    EXPECT_TRUE(Brent<T>(tolerance).solve(I.a, I.b, seq.get(0), x_brent));
+    EXPECT_TRUE(ITP<T>(tolerance).solve(I.a, I.b, seq.get(0), x_itp));
+    EXPECT_NEAR(x_newton, r[i], 1.0e-3);
+    EXPECT_NEAR(x_brent, r[i], 1.0e-3);
+    EXPECT_NEAR(x_itp, r[i], 1.0e-3);
+  }
+
+  // Same roots in parallel
+  ThreadPool pool(4);
+  typename Poly<T>::Vector roots{seq.refine_roots(ITP<T>(), true)};
+  typename Poly<T>::Vector roots_parallel{
+      seq.refine_roots(ITP<T>(), pool, true)};
+  ASSERT_EQ(roots.size(), roots_parallel.size());
+  for (int i{0}; i < roots.size(); ++i) {
+    EXPECT_EQ(roots(i), roots_parallel(i));
+  }
+}
+
+TYPED_TEST(RootTest, RefineIntervals) {
+  using T = TypeParam;
+
+  // p(x) = (x + 2)(x - 1/4)(x - 1/2)(x - 3)
+  std::vector<T> r{-2.0, 0.25, 0.5, 3.0};
+  Poly<T> p(1), f(2);
+  p << 1.0;
+  for (T r_i : r) {
+    f << -r_i, 1.0;
+    p *= f;
+  }
+  Sequence<T> seq(p);
+  Tolerance<T> tolerance;
+  tolerance.ulps = 16;
+  auto check = [&](std::vector<T> roots) {
+    ASSERT_EQ(seq.roots_number(), static_cast<Integer>(roots.size()));
+    EXPECT_TRUE(seq.refine_intervals(QIR<T>(tolerance), true));
+    for (int i{0}; i < seq.roots_number(); ++i) {
+      const typename Sequence<T>::Interval &I{seq.interval(i)};
+      EXPECT_LE(I.a, I.b);
+      EXPECT_LE(I.b - I.a, tolerance(std::min(std::abs(I.a), std::abs(I.b))));
+      EXPECT_NEAR((I.a + I.b) / 2, roots[i], std::sqrt(Poly<T>::EPSILON));
+      if (i > 0) {
+        EXPECT_LT(seq.interval(i - 1).b, I.a);
+      }
+    }
+  };
+
+  seq.separate_roots();
+  check(r);
+  seq.separate_roots(0.4, 4.0);
+  check({r[2], r[3]});
+
+  // The refined root is within the bracket
+  tolerance.absolute = 1.0e-3;
+  T x;
+  EXPECT_TRUE(QIR<T>(tolerance).solve(T(0.4), T(0.6), p, x));
+  EXPECT_NEAR(x, r[2], 1.0e-3);
+}
@@ -22,6 +22,18 @@ class SequenceTest : public ::testing::Test {};
 using TestTypes = ::testing::Types<float, double>;
 TYPED_TEST_SUITE(SequenceTest, TestTypes);
 
+// Product of (x - r) over the given roots
+template <typename T>
+Poly<T> from_roots(std::initializer_list<T> roots) {
+  Poly<T> p(1), f(2);
+  p << 1.0;
+  for (T r : roots) {
+    f << -r, 1.0;
+    p = p * f;
+  }
+  return p;
+}
+
 TYPED_TEST(SequenceTest, Test1) {
   using T = TypeParam;
 
@@ -81,3 +93,592 @@ TYPED_TEST(SequenceTest, Test2) {
   EXPECT_EQ(seq.get(2).degree(), 0);
   EXPECT_EQ(seq.get(2).order(), 1);
 }
+
+TYPED_TEST(SequenceTest, BatchSignVariations) {
+  using T = TypeParam;
+
+  Poly<T> p(5);
+  p << 0.0, -2.0, -1.0, 1.5, 1.0;  // p(x) = -2x - x^2 + 1.5x^3 + x^4
+
+  Sequence<T> seq(p);
+
+  // Dense grid with more points than a block, plus the root x = 0
+  constexpr Integer n_points{Poly<T>::BLOCK_SIZE + 101};
+  std::vector<T> x(n_points);
+  for (Integer i{0}; i < n_points; ++i) {
+    x[i] = T(-3.0) + T(6.0) * T(i) / T(n_points);
+  }
+  x.back() = T(0.0);
+
+  std::vector<Integer> sign_var(n_points);
+  std::unique_ptr<bool[]> on_root(new bool[n_points]);
+  seq.sign_variations(x, sign_var, std::span<bool>(on_root.get(), n_points));
+
+  bool on_root_i;
+  for (Integer i{0}; i < n_points; ++i) {
+    EXPECT_EQ(sign_var[i], seq.sign_variations(x[i], on_root_i));
+    EXPECT_EQ(on_root[i], on_root_i);
+  }
+}
+
+TYPED_TEST(SequenceTest, PackedSignVariations) {
+  using T = TypeParam;
+
+  // Polynomial with roots 0.25, 0.5, ..., 2.5, so that the sequence spans more
+  // than one group of lanes
+  Poly<T> p, f;
+  p.set_scalar(1.0);
+  for (Integer i{1}; i <= 10; ++i) {
+    p *= f.set_monomial(-T(0.25) * T(i));
+  }
+
+  Sequence<T> seq(p);
+  EXPECT_GT(seq.length(), Sequence<T>::LANES);
+
+  bool on_root;
+  for (T x : {T(0.1), T(0.6), T(1.1), T(2.6)}) {
+    Integer sign_var{0}, last_sign{0};
+    for (Integer i{0}; i < seq.length(); ++i) {
+      T v{seq.get(i).evaluate(x)};
+      Integer v_sign{(v > 0) - (v < 0)};
+      if (v_sign * last_sign < 0) {
+        ++sign_var;
+      }
+      if (v_sign != 0) {
+        last_sign = v_sign;
+      }
+    }
+    EXPECT_EQ(seq.sign_variations(x, on_root), sign_var);
+    EXPECT_FALSE(on_root);
+  }
+  EXPECT_EQ(seq.sign_variations(T(0.1), on_root) -
+                seq.sign_variations(T(2.6), on_root),
+            10);
+}
+
+TYPED_TEST(SequenceTest, FixedDegree) {
+  using T = TypeParam;
+
+  Poly<T> p(5);
+  p << 0.5, -2.0, -1.0, 1.5, 1.0;  // p(x) = 0.5 - 2x - x^2 + 1.5x^3 + x^4
+  Poly<T, 4> p_fixed(5);
+  p_fixed << 0.5, -2.0, -1.0, 1.5, 1.0;
+
+  Sequence<T> seq(p);
+  Sequence<T, 4> seq_fixed(p_fixed);
+
+  EXPECT_EQ(seq_fixed.length(), seq.length());
+  for (Integer i{0}; i < seq.length(); ++i) {
+    EXPECT_EQ(seq_fixed.get(i).order(), seq.get(i).order());
+    EXPECT_TRUE(seq_fixed.get(i).coeffs().isApprox(seq.get(i).coeffs()));
+  }
+
+  EXPECT_EQ(seq_fixed.separate_roots(-10.0, 10.0),
+            seq.separate_roots(-10.0, 10.0));
+  for (Integer i{0}; i < seq.roots_number(); ++i) {
+    EXPECT_EQ(seq_fixed.interval(i).a, seq.interval(i).a);
+    EXPECT_EQ(seq_fixed.interval(i).b, seq.interval(i).b);
+  }
+}
+
+TYPED_TEST(SequenceTest, Rebuild) {
+  using T = TypeParam;
+
+  Poly<T> p1(3);
+  p1 << 1.0, -3.0, 2.0;  // p1(x) = 1 - 3x + 2x^2
+  Poly<T> p2(5);
+  p2 << 0.5, -2.0, -1.0, 1.5, 1.0;  // p2(x) = 0.5 - 2x - x^2 + 1.5x^3 + x^4
+  Poly<T> p3(4);
+  p3 << 2.0, -3.0, 0.0, 1.0;  // p3(x) = (x - 1)^2 (x + 2), not square-free
+
+  // The same object is rebuilt for polynomials of different degrees
+  Sequence<T> seq;
+  for (const Poly<T> *p : {&p1, &p2, &p3, &p1, &p3}) {
+    seq.build(*p);
+    Sequence<T> seq_sol(*p);
+    EXPECT_EQ(seq.length(), seq_sol.length());
+    for (Integer i{0}; i < seq.length(); ++i) {
+      EXPECT_EQ(seq.get(i).order(), seq_sol.get(i).order());
+      EXPECT_TRUE(seq.get(i).coeffs().isApprox(seq_sol.get(i).coeffs()));
+    }
+  }
+
+  Sequence<T> seq_sol(p3);
+  EXPECT_EQ(seq.separate_roots(-10.0, 10.0),
+            seq_sol.separate_roots(-10.0, 10.0));
+}
+
+TYPED_TEST(SequenceTest, RootsOnBisectionPoints) {
+  using T = TypeParam;
+
+  // p(x) = (x - 1/4)(x - 1/2), whose roots are midpoints of the bisection
+  // of [-1, 1]
+  Poly<T> p(3);
+  p << 0.125, -0.75, 1.0;
+  Sequence<T> seq(p);
+  for (T a : {T(-1.0), T(0.25)}) {
+    ASSERT_EQ(seq.separate_roots(a, T(1.0)), 2);
+    typename Sequence<T>::Vector roots{seq.refine_roots(Newton<T>())};
+    EXPECT_EQ(roots[0], T(0.25));
+    EXPECT_EQ(roots[1], T(0.5));
+  }
+}
+
+TYPED_TEST(SequenceTest, DescartesFilter) {
+  using T = TypeParam;
+
+  // p(x) = (x + 3)(x + 1.25)(x - 0.3)(x - 0.7)(x - 2.5)(x - 4)
+  Poly<T> p{from_roots({T(-3.0), T(-1.25), T(0.3), T(0.7), T(2.5), T(4.0)})};
+
+  Sequence<T> seq(p), seq_filter(p);
+  EXPECT_FALSE(seq_filter.filter());
+  seq_filter.set_filter(true);
+  EXPECT_TRUE(seq_filter.filter());
+
+  EXPECT_EQ(seq.separate_roots(-10.0, 10.0), 6);
+  EXPECT_EQ(seq_filter.separate_roots(-10.0, 10.0), 6);
+  for (Integer i{0}; i < seq.roots_number(); ++i) {
+    EXPECT_EQ(seq_filter.interval(i).a, seq.interval(i).a);
+    EXPECT_EQ(seq_filter.interval(i).b, seq.interval(i).b);
+    EXPECT_EQ(seq_filter.interval(i).va, seq.interval(i).va);
+    EXPECT_EQ(seq_filter.interval(i).vb, seq.interval(i).vb);
+  }
+
+  // Every midpoint is either evaluated or deduced by the filter
+  const typename Sequence<T>::Statistics &stats{seq_filter.statistics()};
+  EXPECT_GT(stats.filtered, 0);
+  EXPECT_GE(stats.filter_tests, stats.filtered);
+  EXPECT_EQ(stats.evaluations + stats.filtered,
+            seq.statistics().evaluations);
+}
+
+TYPED_TEST(SequenceTest, Clusters) {
+  using T = TypeParam;
+
+  // p(x) = (x - 1)(x - 1 - d)(x + 2), with two roots closer than the
+  // accuracy of a double root
+  T d{std::is_same_v<T, float> ? T(1.0e-4) : T(std::ldexp(1.0, -30))};
+  Poly<T> p{from_roots({T(1.0), T(1.0) + d, T(-2.0)})};
+
+  Sequence<T> seq(p);
+  EXPECT_FALSE(seq.cluster_detection());
+  seq.set_cluster_detection(true);
+  EXPECT_TRUE(seq.cluster_detection());
+  // On bounds whose bisection points miss the roots, since a root at a
+  // bisection point is isolated exactly and splits the cluster
+  EXPECT_EQ(seq.separate_roots(T(-3.0), T(3.5)), 2);
+  EXPECT_GT(seq.statistics().cluster_tests, 0);
+  EXPECT_EQ(seq.interval(0).multiplicity, 1);
+  EXPECT_LT(seq.interval(0).a, T(-2.0));
+  EXPECT_GT(seq.interval(0).b, T(-2.0));
+  EXPECT_EQ(seq.interval(1).multiplicity, 2);
+  EXPECT_LE(seq.interval(1).a, T(1.0));
+  EXPECT_GE(seq.interval(1).b, T(1.0) + d);
+  EXPECT_LT(seq.interval(1).b - seq.interval(1).a, T(0.1));
+
+  // The root of a cluster is the midpoint of its interval
+  typename Sequence<T>::Vector roots{seq.refine_roots(Newton<T>())};
+  EXPECT_NEAR(roots[0], T(-2.0), T(1.0e-5));
+  EXPECT_NEAR(roots[1], T(1.0), T(0.1));
+
+  // Without the detection, no interval is a cluster
+  seq.set_cluster_detection(false);
+  seq.separate_roots();
+  for (Integer i{0}; i < seq.roots_number(); ++i) {
+    EXPECT_EQ(seq.interval(i).multiplicity, 1);
+  }
+
+  // Close roots that the sequence can still separate are not lumped together
+  T e{std::is_same_v<T, float> ? T(2.0e-3) : T(1.0e-7)};
+  Sequence<T> seq_e(from_roots({T(1.0), T(1.0) + e, T(-2.0)}));
+  seq_e.set_cluster_detection(true);
+  ASSERT_EQ(seq_e.separate_roots(T(-3.0), T(3.5)), 3);
+  for (Integer i{0}; i < seq_e.roots_number(); ++i) {
+    EXPECT_EQ(seq_e.interval(i).multiplicity, 1);
+  }
+  EXPECT_LE(seq_e.interval(1).a, T(1.0));
+  EXPECT_GE(seq_e.interval(1).b, T(1.0));
+  EXPECT_LE(seq_e.interval(2).a, T(1.0) + e);
+  EXPECT_GE(seq_e.interval(2).b, T(1.0) + e);
+}
+
+TYPED_TEST(SequenceTest, Limits) {
+  using T        = TypeParam;
+  using Options  = typename Sequence<T>::Options;
+  using Interval = typename Sequence<T>::Interval;
+
+  // p(x) = (x - 1)(x - 2)(x - 3)(x - 4)(x - 5)(x - 6)
+  Poly<T> p{from_roots({T(1.0), T(2.0), T(3.0), T(4.0), T(5.0), T(6.0)})};
+
+  // Every root lies in one of the intervals, resolved or not
+  auto check = [](const Sequence<T> &seq) {
+    Integer n_roots{0}, n_unresolved{0};
+    for (Integer i{0}; i < seq.roots_number(); ++i) {
+      const Interval &I{seq.interval(i)};
+      n_roots += std::abs(I.va - I.vb);
+      if (I.unresolved) {
+        EXPECT_GT(std::abs(I.va - I.vb), 1);
+        ++n_unresolved;
+      }
+    }
+    EXPECT_EQ(n_roots, 6);
+    EXPECT_EQ(n_unresolved, seq.statistics().unresolved);
+  };
+
+  // No limits
+  Sequence<T> seq(p);
+  EXPECT_EQ(seq.separate_roots(0.0, 10.0, Options()), 6);
+  EXPECT_EQ(seq.statistics().unresolved, 0);
+  check(seq);
+
+  // Evaluations
+  Options options;
+  options.max_evaluations = 4;
+  EXPECT_LT(seq.separate_roots(0.0, 10.0, options), 6);
+  EXPECT_GT(seq.statistics().unresolved, 0);
+  EXPECT_LE(seq.statistics().evaluations, 4 + 2);
+  check(seq);
+
+  // Depth
+  options                 = Options();
+  options.max_depth       = 2;
+  seq.separate_roots(0.0, 10.0, options);
+  EXPECT_GT(seq.statistics().unresolved, 0);
+  for (Integer i{0}; i < seq.roots_number(); ++i) {
+    EXPECT_LE(seq.interval(i).depth, 2);
+  }
+  check(seq);
+  EXPECT_FALSE(seq.refine_intervals());
+
+  // Deadline already passed, the whole interval is left unresolved
+  options          = Options();
+  options.deadline = Sequence<T>::Clock::now();
+  EXPECT_EQ(seq.separate_roots(0.0, 10.0, options), 1);
+  EXPECT_TRUE(seq.interval(0).unresolved);
+  EXPECT_EQ(seq.statistics().evaluations, 2);
+  check(seq);
+
+  // Parallel
+  ThreadPool pool(4);
+  options                 = Options();
+  options.max_evaluations = 3;
+  seq.separate_roots(0.0, 10.0, pool, options);
+  EXPECT_GT(seq.statistics().unresolved, 0);
+  check(seq);
+  EXPECT_EQ(seq.separate_roots(0.0, 10.0, pool, Options()), 6);
+  check(seq);
+
+  // With a depth limit, the same intervals as the serial separation, in the
+  // same order and with all the fields
+  options           = Options();
+  options.max_depth = 2;
+  Sequence<T> seq_serial(p);
+  seq_serial.separate_roots(0.0, 10.0, options);
+  ASSERT_EQ(seq.separate_roots(0.0, 10.0, pool, options),
+            seq_serial.roots_number());
+  for (Integer i{0}; i < seq.roots_number(); ++i) {
+    const Interval &I{seq.interval(i)}, &I_s{seq_serial.interval(i)};
+    EXPECT_EQ(I.a, I_s.a);
+    EXPECT_EQ(I.b, I_s.b);
+    EXPECT_EQ(I.va, I_s.va);
+    EXPECT_EQ(I.vb, I_s.vb);
+    EXPECT_EQ(I.a_on_root, I_s.a_on_root);
+    EXPECT_EQ(I.b_on_root, I_s.b_on_root);
+    EXPECT_EQ(I.multiplicity, I_s.multiplicity);
+    EXPECT_EQ(I.depth, I_s.depth);
+    EXPECT_EQ(I.unresolved, I_s.unresolved);
+  }
+}
+
+TYPED_TEST(SequenceTest, Search) {
+  using T        = TypeParam;
+  using Interval = typename Sequence<T>::Interval;
+
+  // p(x) = (x + 3)(x + 1.25)(x - 0.3)(x - 0.7)(x - 2)(x - 2.5)(x - 4)
+  Poly<T> p{
+      from_roots({T(-3.0), T(-1.25), T(0.3), T(0.7), T(2.0), T(2.5), T(4.0)})};
+
+  // Same intervals as the root separation, in the same order, also with
+  // roots on the bounds and at the midpoints
+  Sequence<T> seq(p);
+  for (auto [a, b] : {std::pair<T, T>(-10.0, 10.0),
+                      std::pair<T, T>(-3.0, 4.0),
+                      std::pair<T, T>(0.0, 4.0),
+                      std::pair<T, T>(0.5, 0.6)}) {
+    typename Sequence<T>::Search search{seq.search(a, b)};
+    Integer n_roots{seq.separate_roots(a, b)};
+    Interval I;
+    for (Integer i{0}; i < n_roots; ++i) {
+      ASSERT_TRUE(search.next_interval(I));
+      EXPECT_EQ(I.a, seq.interval(i).a);
+      EXPECT_EQ(I.b, seq.interval(i).b);
+      EXPECT_EQ(I.va, seq.interval(i).va);
+      EXPECT_EQ(I.vb, seq.interval(i).vb);
+    }
+    EXPECT_FALSE(search.next_interval(I));
+    EXPECT_TRUE(search.done());
+    EXPECT_EQ(search.statistics().evaluations,
+              seq.statistics().evaluations);
+  }
+
+  // The first root only takes a part of the evaluations
+  EXPECT_EQ(seq.separate_roots(), 7);
+  typename Sequence<T>::Search search{seq.search()};
+  T r;
+  EXPECT_TRUE(search.next_root(Newton<T>(), r));
+  EXPECT_NEAR(r, T(-3.0), T(1.0e-5));
+  EXPECT_FALSE(search.done());
+  EXPECT_LT(search.statistics().evaluations,
+            seq.statistics().evaluations);
+  EXPECT_TRUE(search.next_root(Newton<T>(), r));
+  EXPECT_NEAR(r, T(-1.25), T(1.0e-5));
+}
+
+TYPED_TEST(SequenceTest, SharedQueries) {
+  using T      = TypeParam;
+  using Result = typename Sequence<T>::Result;
+
+  // p(x) = (x + 3)(x + 1.25)(x - 0.3)(x - 0.7)(x - 2.5)(x - 4)
+  Poly<T> p{from_roots({T(-3.0), T(-1.25), T(0.3), T(0.7), T(2.5), T(4.0)})};
+
+  // One sequence queried by several threads at once, each query with its
+  // own result, gives the same intervals and roots as the serial queries
+  const Sequence<T> seq(p);
+  constexpr Integer n_queries{64};
+  std::vector<Result> results(n_queries);
+  std::vector<Integer> counts(n_queries);
+  auto bounds = [](Integer k) {
+    T h{T(k) / T(16.0) + T(0.03125)};  // exact, whatever the contraction
+    return std::pair<T, T>(T(-4.0) + h, T(0.5) + h);
+  };
+  ThreadPool pool(4);
+  pool.parallel_for(n_queries, [&](Integer k) {
+    auto [a, b] = bounds(k);
+    counts[k]   = seq.count_roots(a, b);
+    seq.separate_roots(a, b, results[k]);
+    seq.refine_roots(Newton<T>(), results[k]);
+  });
+
+  Sequence<T> seq_serial(p);
+  for (Integer k{0}; k < n_queries; ++k) {
+    auto [a, b]     = bounds(k);
+    Integer n_roots = seq_serial.separate_roots(a, b);
+    typename Sequence<T>::Vector roots{seq_serial.refine_roots(Newton<T>())};
+    const Result &result{results[k]};
+    EXPECT_EQ(counts[k], n_roots);
+    EXPECT_EQ(result.a, a);
+    EXPECT_EQ(result.b, b);
+    EXPECT_EQ(result.statistics.evaluations,
+              seq_serial.statistics().evaluations);
+    ASSERT_EQ(static_cast<Integer>(result.intervals.size()), n_roots);
+    ASSERT_EQ(static_cast<Integer>(result.roots.size()), n_roots);
+    for (Integer i{0}; i < n_roots; ++i) {
+      EXPECT_EQ(result.intervals[i].a, seq_serial.interval(i).a);
+      EXPECT_EQ(result.intervals[i].b, seq_serial.interval(i).b);
+      EXPECT_EQ(result.roots[i], roots[i]);
+    }
+  }
+
+  // The intervals of a result are refined apart from the sequence
+  Result result;
+  EXPECT_EQ(seq.separate_roots(-10.0, 10.0, result), 6);
+  EXPECT_TRUE(seq.refine_intervals(result));
+  for (Integer i{0}; i < 6; ++i) {
+    EXPECT_LE(result.intervals[i].b - result.intervals[i].a,
+              QIR<T>().tolerance(result.intervals[i].a,
+                                 result.intervals[i].b));
+  }
+  EXPECT_EQ(seq.roots_number(), 0);
+}
+
+TYPED_TEST(SequenceTest, CountRoots) {
+  using T = TypeParam;
+
+  // p(x) = (x + 3)(x + 1.25)(x - 0.3)(x - 0.7)(x - 2.5)(x - 4)(x^2 + 1)
+  Poly<T> p(3);
+  p << 1.0, 0.0, 1.0;
+  p = p * from_roots({T(-3.0), T(-1.25), T(0.3), T(0.7), T(2.5), T(4.0)});
+  Sequence<T> seq(p);
+
+  // Signs at infinity, without evaluations
+  EXPECT_EQ(seq.count_roots(), 6);
+
+  // Counts between consecutive breakpoints
+  std::vector<T> x{-5.0, -2.0, -1.0, 0.5, 1.0, 3.0, 5.0, 10.0};
+  std::vector<Integer> counts(x.size() - 1);
+  EXPECT_EQ(seq.count_roots(x, counts), 6);
+  EXPECT_EQ(counts, (std::vector<Integer>{1, 1, 1, 1, 1, 1, 0}));
+  for (std::size_t i{0}; i < counts.size(); ++i) {
+    EXPECT_EQ(counts[i], seq.count_roots(x[i], x[i + 1]));
+  }
+
+  // Unsorted breakpoints
+  std::reverse(x.begin(), x.end());
+  EXPECT_EQ(seq.count_roots(x, counts), 6);
+  EXPECT_EQ(counts, (std::vector<Integer>{0, 1, 1, 1, 1, 1, 1}));
+  x = {1.0, -5.0, 5.0};
+  counts.resize(2);
+  EXPECT_EQ(seq.count_roots(x, counts), 10);
+  EXPECT_EQ(counts, (std::vector<Integer>{4, 6}));
+}
+
+TYPED_TEST(SequenceTest, Brackets) {
+  using T   = TypeParam;
+  using Seq = Sequence<T>;
+
+  // p(x) = (x + 3)(x + 1.25)(x - 0.3)(x - 0.7)(x - 2.5)(x - 4)
+  Poly<T> p{from_roots({T(-3.0), T(-1.25), T(0.3), T(0.7), T(2.5), T(4.0)})};
+
+  // Same intervals as the root separation, already in order, also with
+  // roots on the bounds
+  Seq seq(p);
+  typename Seq::Brackets brackets;
+  for (auto [a, b] : {std::pair<T, T>(-10.0, 10.0),
+                      std::pair<T, T>(-3.0, 4.0),
+                      std::pair<T, T>(0.5, 0.6)}) {
+    Integer n_roots{seq.separate_roots(a, b)};
+    ASSERT_EQ(seq.separate_roots(a, b, brackets), n_roots);
+    EXPECT_EQ(brackets.statistics.evaluations,
+              seq.statistics().evaluations);
+    for (Integer i{0}; i < n_roots; ++i) {
+      const typename Seq::Interval &I{seq.interval(i)};
+      EXPECT_EQ(brackets.a[i], I.a);
+      EXPECT_EQ(brackets.b[i], I.b);
+      EXPECT_EQ((brackets.flags[i] & Seq::A_ON_ROOT) != 0, I.a_on_root);
+      EXPECT_EQ((brackets.flags[i] & Seq::B_ON_ROOT) != 0, I.b_on_root);
+    }
+  }
+
+  // The arrays are reused
+  seq.separate_roots(-10.0, 10.0, brackets);
+  const T *a_data{brackets.a.data()};
+  seq.separate_roots(-10.0, 10.0, brackets);
+  EXPECT_EQ(brackets.a.data(), a_data);
+
+  // Limits
+  typename Seq::Options options;
+  options.max_evaluations = 4;
+  seq.separate_roots(-10.0, 10.0, brackets, options);
+  EXPECT_GT(brackets.statistics.unresolved, 0);
+  Integer n_unresolved{0};
+  for (Integer flags : brackets.flags) {
+    n_unresolved += (flags & Seq::UNRESOLVED) != 0;
+  }
+  EXPECT_EQ(n_unresolved, brackets.statistics.unresolved);
+
+  // Fixed degree
+  Poly<T, 6> p_fixed(p);
+  Sequence<T, 6> seq_fixed(p_fixed);
+  typename Sequence<T, 6>::Brackets brackets_fixed;
+  EXPECT_EQ(seq.separate_roots(-10.0, 10.0), 6);
+  EXPECT_EQ(seq_fixed.separate_roots(-10.0, 10.0, brackets_fixed), 6);
+  for (Integer i{0}; i < 6; ++i) {
+    EXPECT_EQ(brackets_fixed.a[i], seq.interval(i).a);
+  }
+}
+
+TYPED_TEST(SequenceTest, Certified) {
+  using T = TypeParam;
+
+  // Four roots 1, 1 + d, 1 + 2d, 1 + 3d, close enough for the rounding errors
+  // of the sequence to flip its signs between them
+  T d{std::is_same_v<T, float> ? T(0.03125) : T(0.00048828125)};
+  Poly<T> p{from_roots({T(1.0), T(1.0) + d, T(1.0) + T(2.0) * d,
+                        T(1.0) + T(3.0) * d})};
+  Sequence<T> seq(p);
+  EXPECT_FALSE(seq.certified());
+  seq.set_certified(true);
+  EXPECT_TRUE(seq.certified());
+
+  // The sign variations never increase from left to right
+  T a{T(1.0) - d}, b{T(1.0) + T(4.0) * d};
+  bool on_root;
+  Integer v_prev{seq.sign_variations(a, on_root)};
+  for (Integer i{1}; i <= 4000; ++i) {
+    Integer v{seq.sign_variations(a + (b - a) * T(i) / T(4000.0), on_root)};
+    EXPECT_LE(v, v_prev);
+    v_prev = v;
+  }
+
+  // The uncertain signs are escalated
+  EXPECT_EQ(seq.separate_roots(a, b), 4);
+  EXPECT_GT(seq.statistics().escalations, 0);
+  for (Integer i{0}; i < 4; ++i) {
+    EXPECT_LE(seq.interval(i).a, T(1.0) + T(i) * d);
+    EXPECT_GE(seq.interval(i).b, T(1.0) + T(i) * d);
+  }
+  seq.set_certified(false);
+  seq.separate_roots(a, b);
+  EXPECT_EQ(seq.statistics().escalations, 0);
+
+  // p(x) = (x^2 - 1)((x - 1)^2 - u), with u the unit roundoff, has exact
+  // coefficients and the exact root 1, while the sign of p(1 + epsilon) is
+  // still uncertain after the compensated evaluation
+  T u{std::numeric_limits<T>::epsilon() / T(2.0)};
+  Poly<T> q(5);
+  q << u - T(1.0), 2.0, -u, -2.0, 1.0;
+  Sequence<T> seq_q(q);
+  seq_q.set_certified(true);
+  T x{T(1.0) + T(2.0) * u}, error;
+  T q_x{seq_q.get(0).evaluate_compensated(x, error)};
+  ASSERT_NE(q_x, T(0.0));
+  ASSERT_LE(std::abs(q_x), error);
+  seq_q.sign_variations(T(1.0), on_root);
+  EXPECT_TRUE(on_root);
+  seq_q.sign_variations(x, on_root);
+  EXPECT_FALSE(on_root);
+
+  // The bisection moves off such a midpoint instead of taking it as a root
+  T a_q{-1.5}, b_q{T(3.5) + T(4.0) * u};
+  ASSERT_EQ((a_q + b_q) / T(2.0), x);
+  Integer n_q{seq_q.separate_roots(a_q, b_q)};
+  EXPECT_EQ(n_q, seq_q.count_roots(a_q, b_q));
+  for (Integer i{0}; i < n_q; ++i) {
+    if (seq_q.interval(i).a_on_root) {
+      EXPECT_EQ(seq_q.get(0).evaluate_compensated(seq_q.interval(i).a, error),
+                T(0.0));
+    }
+  }
+}
+
+TYPED_TEST(SequenceTest, EvaluationStrategies) {
+  using T = TypeParam;
+
+  // The four close roots of the certified test
+  T d{std::is_same_v<T, float> ? T(0.03125) : T(0.00048828125)};
+  Poly<T> p{from_roots({T(1.0), T(1.0) + d, T(1.0) + T(2.0) * d,
+                        T(1.0) + T(3.0) * d})};
+  Sequence<T> seq(p);
+  EXPECT_EQ(seq.evaluation(), Evaluation::NATIVE);
+
+  T a{T(1.0) - d}, b{T(1.0) + T(4.0) * d};
+  for (Evaluation evaluation :
+       {Evaluation::COMPENSATED, Evaluation::DOUBLE_DOUBLE}) {
+    seq.set_evaluation(evaluation);
+    EXPECT_EQ(seq.evaluation(), evaluation);
+
+    // The sign variations never increase from left to right
+    bool on_root;
+    Integer v_prev{seq.sign_variations(a, on_root)};
+    for (Integer i{1}; i <= 4000; ++i) {
+      Integer v{seq.sign_variations(a + (b - a) * T(i) / T(4000.0), on_root)};
+      EXPECT_LE(v, v_prev);
+      v_prev = v;
+    }
+    EXPECT_EQ(seq.separate_roots(a, b), 4);
+  }
+
+  // The strategies agree on a well-conditioned polynomial
+  Poly<T> q(4);
+  q << -6.0, 11.0, -6.0, 1.0;
+  Sequence<T> seq_q(q);
+  bool on_root;
+  for (T x : {T(0.0), T(1.5), T(2.5), T(4.0)}) {
+    seq_q.set_evaluation(Evaluation::NATIVE);
+    Integer v{seq_q.sign_variations(x, on_root)};
+    seq_q.set_evaluation(Evaluation::COMPENSATED);
+    EXPECT_EQ(seq_q.sign_variations(x, on_root), v);
+    seq_q.set_evaluation(Evaluation::DOUBLE_DOUBLE);
+    EXPECT_EQ(seq_q.sign_variations(x, on_root), v);
+  }
+}